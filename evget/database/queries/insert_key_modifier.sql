@@ -1,2 +0,0 @@
--- Insert modifiers for a key event.
-insert into key_modifier values ($1, $2, $3);
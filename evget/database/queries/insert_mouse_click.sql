@@ -1,2 +0,0 @@
--- Insert a mouse click event.
-insert into mouse_click values ($1, $2, $3, $4, $5, $6, $7, $8, $9, $10, $11, $12, $13, $14, $15, $16, $17, $18, $19, $20);
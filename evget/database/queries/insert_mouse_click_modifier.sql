@@ -1,2 +0,0 @@
--- Insert modifiers for a mouse click event.
-insert into mouse_click_modifier values ($1, $2, $3);
@@ -1,2 +0,0 @@
--- Insert a mouse move event.
-insert into mouse_move values ($1, $2, $3, $4, $5, $6, $7, $8, $9, $10, $11, $12, $13, $14, $15, $16, $17);
@@ -1,2 +0,0 @@
--- Insert modifiers for a mouse move event.
-insert into mouse_move_modifier values ($1, $2, $3);
@@ -1,2 +0,0 @@
--- Insert modifiers for a mouse scroll event.
-insert into mouse_scroll_modifier values ($1, $2, $3);
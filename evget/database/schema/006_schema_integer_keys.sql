@@ -0,0 +1,201 @@
+-- Replace random text uuid primary keys with integer row ids. Existing rows keep their insertion order
+-- by using the implicit rowid of the old tables as the new id.
+
+alter table key_modifier rename to key_modifier_old;
+alter table key rename to key_old;
+
+create table key (
+    id integer primary key,
+    interval real,
+    timestamp text not null,
+    position_x real,
+    position_y real,
+    device_name text,
+    focus_window_name text,
+    focus_window_position_x real,
+    focus_window_position_y real,
+    focus_window_width real,
+    focus_window_height real,
+    screen real,
+    device_id text,
+    system_event text,
+    event_source text,
+    device_type integer not null references device_type(id),
+    button_id integer,
+    button_name text,
+    character text,
+    button_action integer not null references button_action(id)
+);
+
+create table key_modifier (
+    id integer primary key,
+    key_id integer not null references key(id),
+    modifier_id integer not null references modifier(id)
+);
+
+insert into key (
+    id, interval, timestamp, position_x, position_y, device_name, focus_window_name,
+    focus_window_position_x, focus_window_position_y, focus_window_width, focus_window_height,
+    screen, device_id, system_event, event_source, device_type, button_id, button_name, character,
+    button_action
+)
+select
+    rowid, interval, timestamp, position_x, position_y, device_name, focus_window_name,
+    focus_window_position_x, focus_window_position_y, focus_window_width, focus_window_height,
+    screen, device_id, system_event, event_source, device_type, button_id, button_name, character,
+    button_action
+from key_old order by rowid;
+
+insert into key_modifier (key_id, modifier_id)
+select key_old.rowid, cast(key_modifier_old.modifier_id as integer) from key_modifier_old
+join key_old on key_modifier_old.key_uuid = key_old.uuid order by key_modifier_old.rowid;
+
+drop table key_modifier_old;
+drop table key_old;
+
+alter table mouse_click_modifier rename to mouse_click_modifier_old;
+alter table mouse_click rename to mouse_click_old;
+
+create table mouse_click (
+    id integer primary key,
+    interval real,
+    timestamp text not null,
+    position_x real,
+    position_y real,
+    device_name text,
+    focus_window_name text,
+    focus_window_position_x real,
+    focus_window_position_y real,
+    focus_window_width real,
+    focus_window_height real,
+    screen real,
+    device_id text,
+    system_event text,
+    event_source text,
+    device_type integer not null references device_type(id),
+    touch_id integer,
+    button_id integer,
+    button_name text,
+    button_action integer not null references button_action(id)
+);
+
+create table mouse_click_modifier (
+    id integer primary key,
+    mouse_click_id integer not null references mouse_click(id),
+    modifier_id integer not null references modifier(id)
+);
+
+insert into mouse_click (
+    id, interval, timestamp, position_x, position_y, device_name, focus_window_name,
+    focus_window_position_x, focus_window_position_y, focus_window_width, focus_window_height,
+    screen, device_id, system_event, event_source, device_type, touch_id, button_id, button_name,
+    button_action
+)
+select
+    rowid, interval, timestamp, position_x, position_y, device_name, focus_window_name,
+    focus_window_position_x, focus_window_position_y, focus_window_width, focus_window_height,
+    screen, device_id, system_event, event_source, device_type, touch_id, button_id, button_name,
+    button_action
+from mouse_click_old order by rowid;
+
+insert into mouse_click_modifier (mouse_click_id, modifier_id)
+select mouse_click_old.rowid, cast(mouse_click_modifier_old.modifier_id as integer) from mouse_click_modifier_old
+join mouse_click_old on mouse_click_modifier_old.mouse_click_uuid = mouse_click_old.uuid order by mouse_click_modifier_old.rowid;
+
+drop table mouse_click_modifier_old;
+drop table mouse_click_old;
+
+alter table mouse_move_modifier rename to mouse_move_modifier_old;
+alter table mouse_move rename to mouse_move_old;
+
+create table mouse_move (
+    id integer primary key,
+    interval real,
+    timestamp text not null,
+    position_x real,
+    position_y real,
+    device_name text,
+    focus_window_name text,
+    focus_window_position_x real,
+    focus_window_position_y real,
+    focus_window_width real,
+    focus_window_height real,
+    screen real,
+    device_id text,
+    system_event text,
+    event_source text,
+    device_type integer not null references device_type(id),
+    touch_id integer
+);
+
+create table mouse_move_modifier (
+    id integer primary key,
+    mouse_move_id integer not null references mouse_move(id),
+    modifier_id integer not null references modifier(id)
+);
+
+insert into mouse_move (
+    id, interval, timestamp, position_x, position_y, device_name, focus_window_name,
+    focus_window_position_x, focus_window_position_y, focus_window_width, focus_window_height,
+    screen, device_id, system_event, event_source, device_type, touch_id
+)
+select
+    rowid, interval, timestamp, position_x, position_y, device_name, focus_window_name,
+    focus_window_position_x, focus_window_position_y, focus_window_width, focus_window_height,
+    screen, device_id, system_event, event_source, device_type, touch_id
+from mouse_move_old order by rowid;
+
+insert into mouse_move_modifier (mouse_move_id, modifier_id)
+select mouse_move_old.rowid, cast(mouse_move_modifier_old.modifier_id as integer) from mouse_move_modifier_old
+join mouse_move_old on mouse_move_modifier_old.mouse_click_uuid = mouse_move_old.uuid order by mouse_move_modifier_old.rowid;
+
+drop table mouse_move_modifier_old;
+drop table mouse_move_old;
+
+alter table mouse_scroll_modifier rename to mouse_scroll_modifier_old;
+alter table mouse_scroll rename to mouse_scroll_old;
+
+create table mouse_scroll (
+    id integer primary key,
+    interval real,
+    timestamp text not null,
+    position_x real,
+    position_y real,
+    device_name text,
+    focus_window_name text,
+    focus_window_position_x real,
+    focus_window_position_y real,
+    focus_window_width real,
+    focus_window_height real,
+    screen real,
+    device_id text,
+    system_event text,
+    event_source text,
+    device_type integer not null references device_type(id),
+    scroll_vertical real,
+    scroll_horizontal real
+);
+
+create table mouse_scroll_modifier (
+    id integer primary key,
+    mouse_scroll_id integer not null references mouse_scroll(id),
+    modifier_id integer not null references modifier(id)
+);
+
+insert into mouse_scroll (
+    id, interval, timestamp, position_x, position_y, device_name, focus_window_name,
+    focus_window_position_x, focus_window_position_y, focus_window_width, focus_window_height,
+    screen, device_id, system_event, event_source, device_type, scroll_vertical, scroll_horizontal
+)
+select
+    rowid, interval, timestamp, position_x, position_y, device_name, focus_window_name,
+    focus_window_position_x, focus_window_position_y, focus_window_width, focus_window_height,
+    screen, device_id, system_event, event_source, device_type, scroll_vertical, scroll_horizontal
+from mouse_scroll_old order by rowid;
+
+insert into mouse_scroll_modifier (mouse_scroll_id, modifier_id)
+select mouse_scroll_old.rowid, cast(mouse_scroll_modifier_old.modifier_id as integer) from mouse_scroll_modifier_old
+join mouse_scroll_old on mouse_scroll_modifier_old.mouse_click_uuid = mouse_scroll_old.uuid order by mouse_scroll_modifier_old.rowid;
+
+drop table mouse_scroll_modifier_old;
+drop table mouse_scroll_old;
@@ -0,0 +1,263 @@
+-- Store timestamps as integer microseconds since the Unix epoch and index them. Existing ISO-8601 text
+-- timestamps are converted by parsing the date, the fractional seconds and the UTC offset, and timestamps
+-- that cannot be parsed become zero. Intervals, which are already microseconds, are stored as integers
+-- too. Each table is rebuilt under a new name and renamed so that the modifier tables keep referencing it.
+
+create table key_new (
+    id integer primary key,
+    interval integer,
+    timestamp integer not null,
+    position_x real,
+    position_y real,
+    device_name text,
+    focus_window_name text,
+    focus_window_position_x real,
+    focus_window_position_y real,
+    focus_window_width real,
+    focus_window_height real,
+    screen real,
+    device_id text,
+    system_event text,
+    event_source text,
+    device_type integer not null references device_type(id),
+    button_id integer,
+    button_name text,
+    character text,
+    button_action integer not null references button_action(id)
+);
+
+insert into key_new (
+    id, interval, timestamp, position_x, position_y, device_name, focus_window_name,
+    focus_window_position_x, focus_window_position_y, focus_window_width, focus_window_height, screen,
+    device_id, system_event, event_source, device_type, button_id, button_name, character, button_action
+)
+select
+    id, cast(interval as integer),
+    coalesce(
+        cast(strftime('%s', substr(timestamp, 1, 19)) as integer) * 1000000
+        + case
+            when substr(timestamp, 20, 1) = '.' then cast(substr(substr(timestamp, 21) || '000000', 1, 6) as integer)
+            else 0
+        end
+        - case substr(timestamp, -5, 1)
+            when '+' then 1
+            when '-' then -1
+            else 0
+        end * (cast(substr(timestamp, -4, 2) as integer) * 3600 + cast(substr(timestamp, -2, 2) as integer) * 60)
+        * 1000000,
+        0
+    ),
+    position_x, position_y, device_name, focus_window_name, focus_window_position_x,
+    focus_window_position_y, focus_window_width, focus_window_height, screen, device_id, system_event,
+    event_source, device_type, button_id, button_name, character, button_action
+from key order by id;
+
+drop table key;
+alter table key_new rename to key;
+
+create index key_timestamp on key (timestamp);
+create index key_device_id_timestamp on key (device_id, timestamp);
+
+-- Exposes the key table with ISO-8601 text timestamps in UTC.
+create view key_iso8601 as
+select
+    id, interval,
+    strftime('%Y-%m-%dT%H:%M:%S', timestamp / 1000000, 'unixepoch')
+    || printf('.%06d', timestamp % 1000000) || 'Z' as timestamp,
+    position_x, position_y, device_name, focus_window_name, focus_window_position_x,
+    focus_window_position_y, focus_window_width, focus_window_height, screen, device_id, system_event,
+    event_source, device_type, button_id, button_name, character, button_action
+from key;
+
+create table mouse_click_new (
+    id integer primary key,
+    interval integer,
+    timestamp integer not null,
+    position_x real,
+    position_y real,
+    device_name text,
+    focus_window_name text,
+    focus_window_position_x real,
+    focus_window_position_y real,
+    focus_window_width real,
+    focus_window_height real,
+    screen real,
+    device_id text,
+    system_event text,
+    event_source text,
+    device_type integer not null references device_type(id),
+    touch_id integer,
+    button_id integer,
+    button_name text,
+    button_action integer not null references button_action(id)
+);
+
+insert into mouse_click_new (
+    id, interval, timestamp, position_x, position_y, device_name, focus_window_name,
+    focus_window_position_x, focus_window_position_y, focus_window_width, focus_window_height, screen,
+    device_id, system_event, event_source, device_type, touch_id, button_id, button_name, button_action
+)
+select
+    id, cast(interval as integer),
+    coalesce(
+        cast(strftime('%s', substr(timestamp, 1, 19)) as integer) * 1000000
+        + case
+            when substr(timestamp, 20, 1) = '.' then cast(substr(substr(timestamp, 21) || '000000', 1, 6) as integer)
+            else 0
+        end
+        - case substr(timestamp, -5, 1)
+            when '+' then 1
+            when '-' then -1
+            else 0
+        end * (cast(substr(timestamp, -4, 2) as integer) * 3600 + cast(substr(timestamp, -2, 2) as integer) * 60)
+        * 1000000,
+        0
+    ),
+    position_x, position_y, device_name, focus_window_name, focus_window_position_x,
+    focus_window_position_y, focus_window_width, focus_window_height, screen, device_id, system_event,
+    event_source, device_type, touch_id, button_id, button_name, button_action
+from mouse_click order by id;
+
+drop table mouse_click;
+alter table mouse_click_new rename to mouse_click;
+
+create index mouse_click_timestamp on mouse_click (timestamp);
+create index mouse_click_device_id_timestamp on mouse_click (device_id, timestamp);
+
+-- Exposes the mouse click table with ISO-8601 text timestamps in UTC.
+create view mouse_click_iso8601 as
+select
+    id, interval,
+    strftime('%Y-%m-%dT%H:%M:%S', timestamp / 1000000, 'unixepoch')
+    || printf('.%06d', timestamp % 1000000) || 'Z' as timestamp,
+    position_x, position_y, device_name, focus_window_name, focus_window_position_x,
+    focus_window_position_y, focus_window_width, focus_window_height, screen, device_id, system_event,
+    event_source, device_type, touch_id, button_id, button_name, button_action
+from mouse_click;
+
+create table mouse_move_new (
+    id integer primary key,
+    interval integer,
+    timestamp integer not null,
+    position_x real,
+    position_y real,
+    device_name text,
+    focus_window_name text,
+    focus_window_position_x real,
+    focus_window_position_y real,
+    focus_window_width real,
+    focus_window_height real,
+    screen real,
+    device_id text,
+    system_event text,
+    event_source text,
+    device_type integer not null references device_type(id),
+    touch_id integer
+);
+
+insert into mouse_move_new (
+    id, interval, timestamp, position_x, position_y, device_name, focus_window_name,
+    focus_window_position_x, focus_window_position_y, focus_window_width, focus_window_height, screen,
+    device_id, system_event, event_source, device_type, touch_id
+)
+select
+    id, cast(interval as integer),
+    coalesce(
+        cast(strftime('%s', substr(timestamp, 1, 19)) as integer) * 1000000
+        + case
+            when substr(timestamp, 20, 1) = '.' then cast(substr(substr(timestamp, 21) || '000000', 1, 6) as integer)
+            else 0
+        end
+        - case substr(timestamp, -5, 1)
+            when '+' then 1
+            when '-' then -1
+            else 0
+        end * (cast(substr(timestamp, -4, 2) as integer) * 3600 + cast(substr(timestamp, -2, 2) as integer) * 60)
+        * 1000000,
+        0
+    ),
+    position_x, position_y, device_name, focus_window_name, focus_window_position_x,
+    focus_window_position_y, focus_window_width, focus_window_height, screen, device_id, system_event,
+    event_source, device_type, touch_id
+from mouse_move order by id;
+
+drop table mouse_move;
+alter table mouse_move_new rename to mouse_move;
+
+create index mouse_move_timestamp on mouse_move (timestamp);
+create index mouse_move_device_id_timestamp on mouse_move (device_id, timestamp);
+
+-- Exposes the mouse move table with ISO-8601 text timestamps in UTC.
+create view mouse_move_iso8601 as
+select
+    id, interval,
+    strftime('%Y-%m-%dT%H:%M:%S', timestamp / 1000000, 'unixepoch')
+    || printf('.%06d', timestamp % 1000000) || 'Z' as timestamp,
+    position_x, position_y, device_name, focus_window_name, focus_window_position_x,
+    focus_window_position_y, focus_window_width, focus_window_height, screen, device_id, system_event,
+    event_source, device_type, touch_id
+from mouse_move;
+
+create table mouse_scroll_new (
+    id integer primary key,
+    interval integer,
+    timestamp integer not null,
+    position_x real,
+    position_y real,
+    device_name text,
+    focus_window_name text,
+    focus_window_position_x real,
+    focus_window_position_y real,
+    focus_window_width real,
+    focus_window_height real,
+    screen real,
+    device_id text,
+    system_event text,
+    event_source text,
+    device_type integer not null references device_type(id),
+    scroll_vertical real,
+    scroll_horizontal real
+);
+
+insert into mouse_scroll_new (
+    id, interval, timestamp, position_x, position_y, device_name, focus_window_name,
+    focus_window_position_x, focus_window_position_y, focus_window_width, focus_window_height, screen,
+    device_id, system_event, event_source, device_type, scroll_vertical, scroll_horizontal
+)
+select
+    id, cast(interval as integer),
+    coalesce(
+        cast(strftime('%s', substr(timestamp, 1, 19)) as integer) * 1000000
+        + case
+            when substr(timestamp, 20, 1) = '.' then cast(substr(substr(timestamp, 21) || '000000', 1, 6) as integer)
+            else 0
+        end
+        - case substr(timestamp, -5, 1)
+            when '+' then 1
+            when '-' then -1
+            else 0
+        end * (cast(substr(timestamp, -4, 2) as integer) * 3600 + cast(substr(timestamp, -2, 2) as integer) * 60)
+        * 1000000,
+        0
+    ),
+    position_x, position_y, device_name, focus_window_name, focus_window_position_x,
+    focus_window_position_y, focus_window_width, focus_window_height, screen, device_id, system_event,
+    event_source, device_type, scroll_vertical, scroll_horizontal
+from mouse_scroll order by id;
+
+drop table mouse_scroll;
+alter table mouse_scroll_new rename to mouse_scroll;
+
+create index mouse_scroll_timestamp on mouse_scroll (timestamp);
+create index mouse_scroll_device_id_timestamp on mouse_scroll (device_id, timestamp);
+
+-- Exposes the mouse scroll table with ISO-8601 text timestamps in UTC.
+create view mouse_scroll_iso8601 as
+select
+    id, interval,
+    strftime('%Y-%m-%dT%H:%M:%S', timestamp / 1000000, 'unixepoch')
+    || printf('.%06d', timestamp % 1000000) || 'Z' as timestamp,
+    position_x, position_y, device_name, focus_window_name, focus_window_position_x,
+    focus_window_position_y, focus_window_width, focus_window_height, screen, device_id, system_event,
+    event_source, device_type, scroll_vertical, scroll_horizontal
+from mouse_scroll;
@@ -0,0 +1,84 @@
+-- Store the modifiers of each event as a bitmask in a single integer column instead of one linking table row per
+-- modifier. Bit `n` of the bitmask is set when the modifier with id `n` in the modifier table was active, so the
+-- names can be recovered with `join modifier on modifiers & (1 << modifier.id) != 0`. Existing linking table rows
+-- are folded into the bitmask before the linking tables are dropped.
+
+alter table key add column modifiers integer not null default 0;
+
+update key set modifiers = (
+    select coalesce(sum(distinct 1 << modifier_id), 0) from key_modifier where key_id = key.id
+);
+
+drop table key_modifier;
+
+-- Exposes the key table with ISO-8601 text timestamps in UTC.
+drop view key_iso8601;
+create view key_iso8601 as
+select
+    id, interval,
+    strftime('%Y-%m-%dT%H:%M:%S', timestamp / 1000000, 'unixepoch')
+    || printf('.%06d', timestamp % 1000000) || 'Z' as timestamp,
+    position_x, position_y, device_name, focus_window_name, focus_window_position_x,
+    focus_window_position_y, focus_window_width, focus_window_height, screen, device_id, system_event,
+    event_source, device_type, button_id, button_name, character, button_action, modifiers
+from key;
+
+alter table mouse_click add column modifiers integer not null default 0;
+
+update mouse_click set modifiers = (
+    select coalesce(sum(distinct 1 << modifier_id), 0) from mouse_click_modifier where mouse_click_id = mouse_click.id
+);
+
+drop table mouse_click_modifier;
+
+-- Exposes the mouse click table with ISO-8601 text timestamps in UTC.
+drop view mouse_click_iso8601;
+create view mouse_click_iso8601 as
+select
+    id, interval,
+    strftime('%Y-%m-%dT%H:%M:%S', timestamp / 1000000, 'unixepoch')
+    || printf('.%06d', timestamp % 1000000) || 'Z' as timestamp,
+    position_x, position_y, device_name, focus_window_name, focus_window_position_x,
+    focus_window_position_y, focus_window_width, focus_window_height, screen, device_id, system_event,
+    event_source, device_type, touch_id, button_id, button_name, button_action, modifiers
+from mouse_click;
+
+alter table mouse_move add column modifiers integer not null default 0;
+
+update mouse_move set modifiers = (
+    select coalesce(sum(distinct 1 << modifier_id), 0) from mouse_move_modifier where mouse_move_id = mouse_move.id
+);
+
+drop table mouse_move_modifier;
+
+-- Exposes the mouse move table with ISO-8601 text timestamps in UTC.
+drop view mouse_move_iso8601;
+create view mouse_move_iso8601 as
+select
+    id, interval,
+    strftime('%Y-%m-%dT%H:%M:%S', timestamp / 1000000, 'unixepoch')
+    || printf('.%06d', timestamp % 1000000) || 'Z' as timestamp,
+    position_x, position_y, device_name, focus_window_name, focus_window_position_x,
+    focus_window_position_y, focus_window_width, focus_window_height, screen, device_id, system_event,
+    event_source, device_type, touch_id, modifiers
+from mouse_move;
+
+alter table mouse_scroll add column modifiers integer not null default 0;
+
+update mouse_scroll set modifiers = (
+    select coalesce(sum(distinct 1 << modifier_id), 0) from mouse_scroll_modifier where mouse_scroll_id = mouse_scroll.id
+);
+
+drop table mouse_scroll_modifier;
+
+-- Exposes the mouse scroll table with ISO-8601 text timestamps in UTC.
+drop view mouse_scroll_iso8601;
+create view mouse_scroll_iso8601 as
+select
+    id, interval,
+    strftime('%Y-%m-%dT%H:%M:%S', timestamp / 1000000, 'unixepoch')
+    || printf('.%06d', timestamp % 1000000) || 'Z' as timestamp,
+    position_x, position_y, device_name, focus_window_name, focus_window_position_x,
+    focus_window_position_y, focus_window_width, focus_window_height, screen, device_id, system_event,
+    event_source, device_type, scroll_vertical, scroll_horizontal, modifiers
+from mouse_scroll;
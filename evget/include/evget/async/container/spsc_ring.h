@@ -0,0 +1,111 @@
+/**
+ * \file spsc_ring.h
+ * \brief Bounded lock-free single-producer single-consumer ring buffer.
+ */
+
+#ifndef EVGET_ASYNC_CONTAINER_SPSC_RING_H
+#define EVGET_ASYNC_CONTAINER_SPSC_RING_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace evget {
+
+/**
+ * \brief A bounded lock-free ring buffer for one producer thread and one consumer thread. Slots are allocated
+ *        up front so pushing never allocates. Only one thread may push at a time and only one thread may pop
+ *        at a time, however the producer and consumer can run concurrently.
+ * \tparam T The element type, which must be default constructible and move assignable.
+ */
+template <class T>
+class SpscRing {
+public:
+    /**
+     * \brief Create a ring buffer.
+     * \param capacity minimum number of elements the buffer can hold, rounded up to a power of two
+     */
+    explicit SpscRing(std::size_t capacity);
+
+    /**
+     * \brief Move a value into the buffer. Must only be called by the producer.
+     * \param value value to move, which is left untouched if the buffer is full
+     * \return whether the value was pushed
+     */
+    constexpr bool TryPush(T&& value);
+
+    /**
+     * \brief Move the oldest value out of the buffer. Must only be called by the consumer.
+     * \return the value, or `nullopt` if the buffer is empty
+     */
+    constexpr std::optional<T> TryPop();
+
+    /**
+     * \brief Get the number of elements in the buffer. This is exact when called by the producer or consumer
+     *        while the other side is idle, and approximate otherwise.
+     * \return the number of elements
+     */
+    [[nodiscard]] constexpr std::size_t Size() const;
+
+    /**
+     * \brief Get the maximum number of elements in the buffer.
+     * \return the capacity
+     */
+    [[nodiscard]] constexpr std::size_t Capacity() const;
+
+private:
+    // A fixed size rather than `std::hardware_destructive_interference_size`, which is not ABI stable.
+    static constexpr std::size_t kCacheLine = 64;
+
+    std::vector<T> slots_;
+    std::size_t mask_;
+    // The consumer position and producer position are kept on separate cache lines to avoid false sharing.
+    alignas(kCacheLine) std::atomic<std::size_t> head_{0};
+    alignas(kCacheLine) std::atomic<std::size_t> tail_{0};
+};
+
+template <class T>
+SpscRing<T>::SpscRing(std::size_t capacity)
+    : slots_(std::bit_ceil(std::max<std::size_t>(capacity, 1))), mask_{slots_.size() - 1} {}
+
+template <class T>
+constexpr bool SpscRing<T>::TryPush(T&& value) {
+    auto tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) == slots_.size()) {
+        return false;
+    }
+
+    slots_[tail & mask_] = std::move(value);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+constexpr std::optional<T> SpscRing<T>::TryPop() {
+    auto head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) {
+        return std::nullopt;
+    }
+
+    std::optional<T> value{std::move(slots_[head & mask_])};
+    head_.store(head + 1, std::memory_order_release);
+    return value;
+}
+
+template <class T>
+constexpr std::size_t SpscRing<T>::Size() const {
+    return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+}
+
+template <class T>
+constexpr std::size_t SpscRing<T>::Capacity() const {
+    return slots_.size();
+}
+
+} // namespace evget
+
+#endif
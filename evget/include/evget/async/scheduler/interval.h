@@ -26,7 +26,7 @@ public:
      * \brief Construct a repeating timer.
      * \param period period for the interval
      */
-    explicit Interval(std::chrono::seconds period);
+    explicit Interval(std::chrono::milliseconds period);
 
     /**
      * \brief Completes when the next period in the interval has been reached. If a tick has been
@@ -40,14 +40,21 @@ public:
      */
     void Reset();
 
+    /**
+     * \brief Change the period and reset the interval to expire one new period after the current time. Not
+     *        thread-safe.
+     * \param period the new period
+     */
+    void SetPeriod(std::chrono::milliseconds period);
+
     /**
      * \brief Get the timer's period.
      * \return the period
      */
-    [[nodiscard]] std::chrono::seconds Period() const;
+    [[nodiscard]] std::chrono::milliseconds Period() const;
 
 private:
-    std::chrono::seconds period_{};
+    std::chrono::milliseconds period_{};
     std::optional<boost::asio::steady_timer> timer_;
 };
 } // namespace evget
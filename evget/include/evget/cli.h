@@ -21,8 +21,10 @@
 #include <utility>
 #include <vector>
 
+#include "evget/database/sqlite/tuning.h"
 #include "evget/error.h"
 #include "evget/event/device_type.h"
+#include "evget/storage/buffer_limits.h"
 #include "evget/storage/store.h"
 
 namespace evget {
@@ -32,7 +34,25 @@ namespace evget {
  */
 enum class StorageType : uint8_t {
     kSqLite, ///< use an SQLite database to store events
-    kJson ///< use JSON for event formatting
+    kJson, ///< use JSON for event formatting
+    kJsonLines ///< use JSON Lines with one compact object per event
+};
+
+/**
+ * \brief Which outputs to stream, writing events as soon as they arrive instead of buffering them.
+ */
+enum class StreamMode : uint8_t {
+    kAuto, ///< stream stdout and buffer every other output
+    kAll, ///< stream every output
+    kNone, ///< buffer every output
+};
+
+/**
+ * \brief The stores created from the outputs, split by whether they are streamed.
+ */
+struct OutputStores {
+    std::vector<std::unique_ptr<Store>> buffered; ///< stores written in batches by the store thresholds
+    std::vector<std::unique_ptr<Store>> streamed; ///< stores written as soon as events arrive
 };
 
 /**
@@ -86,10 +106,18 @@ public:
     static StorageType GetStorageType(const std::string& output);
 
     /**
-     * \brief Convert CLI configuration to `Store` objects.
-     * \return result containing vector of `Store` unique pointers or error
+     * \brief Whether an output is streamed under the configured stream mode.
+     * \param output reference to the output string
+     * \return whether the output is streamed
      */
-    Result<std::vector<std::unique_ptr<Store>>> ToStores();
+    [[nodiscard]] bool IsStreamed(const std::string& output) const;
+
+    /**
+     * \brief Convert CLI configuration to `Store` objects. Streamed JSON outputs are written compactly, with one
+     *        line per write.
+     * \return result containing the buffered and streamed `Store` unique pointers or error
+     */
+    Result<OutputStores> ToStores();
 
     /**
      * \brief Get the configured event source.
@@ -98,16 +126,35 @@ public:
     [[nodiscard]] evget::EventSource EventSource() const;
 
     /**
-     * \brief Get the number of events to store before issuing a write operation.
+     * \brief Get the number of events to store before issuing a write operation. Events which produce several
+     *        entries count once for each entry.
      * \return number of events
      */
     [[nodiscard]] std::size_t StoreNEvents() const;
 
+    /**
+     * \brief Get the approximate number of buffered bytes after which to issue a write operation.
+     * \return number of bytes, where zero disables the threshold
+     */
+    [[nodiscard]] std::size_t StoreNBytes() const;
+
     /**
      * \brief Get the time interval after which to store events.
-     * \return time interval in seconds
+     * \return time interval in milliseconds
+     */
+    [[nodiscard]] std::chrono::milliseconds StoreAfter() const;
+
+    /**
+     * \brief Whether the store interval adapts to hold `StoreAfter` as the target latency.
+     * \return whether the store interval is adaptive
+     */
+    [[nodiscard]] bool StoreAdaptive() const;
+
+    /**
+     * \brief Get which outputs are streamed.
+     * \return stream mode
      */
-    [[nodiscard]] std::chrono::seconds StoreAfter() const;
+    [[nodiscard]] StreamMode Stream() const;
 
     /**
      * \brief Get the screen dimensions.
@@ -133,24 +180,48 @@ public:
      */
     [[nodiscard]] const std::optional<std::set<DeviceType>>& Filter() const;
 
+    /**
+     * \brief Get the SQLite profile applied to database outputs.
+     * \return SQLite profile
+     */
+    [[nodiscard]] evget::SQLiteProfile SQLiteProfile() const;
+
+    /**
+     * \brief Get the limits on events held in memory and the policy applied when they are reached.
+     * \return buffer limits
+     */
+    [[nodiscard]] evget::BufferLimits BufferLimits() const;
+
 private:
     static constexpr std::size_t kDefaultNEvents{100};
-    static constexpr std::size_t kDefaultStoreAfter{100};
+    static constexpr std::chrono::milliseconds kDefaultStoreAfter{std::chrono::seconds{100}};
     static constexpr std::size_t kIndentBy{30};
+    static constexpr std::size_t kMillisPerSecond{1000};
+    static constexpr std::size_t kMillisPerMinute{60 * kMillisPerSecond};
 
     bool ensure_utf8_argv_{true};
     std::vector<std::string> output_;
     std::size_t store_n_events_{kDefaultNEvents};
-    std::size_t store_after_{kDefaultStoreAfter};
+    std::size_t store_n_bytes_{0};
+    std::size_t store_after_ms_{kDefaultStoreAfter.count()};
+    bool store_adaptive_{false};
+    StreamMode stream_{StreamMode::kAuto};
     evget::EventSource event_source_{EventSource::kX11};
     std::optional<spdlog::level::level_enum> log_level_;
     std::optional<std::pair<std::uint32_t, std::uint32_t>> screen_dimensions_;
     std::optional<std::string> display_;
     std::optional<std::string> seat_;
     std::optional<std::set<DeviceType>> filter_;
+    evget::SQLiteProfile sqlite_profile_{SQLiteProfile::kDefault};
+    std::size_t buffer_events_{0};
+    std::size_t buffer_bytes_{0};
+    evget::OverflowPolicy overflow_policy_{OverflowPolicy::kBlock};
     std::vector<std::string> event_source_descriptions_{EventSourceDescriptions()};
     std::vector<std::string> log_level_descriptions_{LogLevelDescriptions()};
     std::vector<std::string> device_type_descriptions_{DeviceTypeDescriptions()};
+    std::vector<std::string> sqlite_profile_descriptions_{SQLiteProfileDescriptions()};
+    std::vector<std::string> overflow_policy_descriptions_{OverflowPolicyDescriptions()};
+    std::vector<std::string> stream_mode_descriptions_{StreamModeDescriptions()};
 
     static std::string FormatEnum(
         const std::string& value_descriptor,
@@ -165,6 +236,15 @@ private:
     static std::map<std::string, spdlog::level::level_enum> LogLevelMappings();
     static std::vector<std::string> DeviceTypeDescriptions();
     static std::map<std::string, DeviceType> DeviceTypeMappings();
+    static std::vector<std::string> SQLiteProfileDescriptions();
+    static std::map<std::string, evget::SQLiteProfile> SQLiteProfileMappings();
+    static std::string ToString(evget::SQLiteProfile profile);
+    static std::vector<std::string> OverflowPolicyDescriptions();
+    static std::map<std::string, evget::OverflowPolicy> OverflowPolicyMappings();
+    static std::string ToString(evget::OverflowPolicy policy);
+    static std::vector<std::string> StreamModeDescriptions();
+    static std::map<std::string, StreamMode> StreamModeMappings();
+    static std::string ToString(StreamMode mode);
 };
 } // namespace evget
 
@@ -6,6 +6,7 @@
 #ifndef EVGET_DATABASE_CONNECTION_H
 #define EVGET_DATABASE_CONNECTION_H
 
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <memory>
@@ -62,6 +63,12 @@ public:
      */
     virtual std::unique_ptr<Query> BuildQuery(std::string query) = 0;
 
+    /**
+     * \brief Get the maximum number of parameters that can be bound to a single query on this connection.
+     * \return a result containing the parameter limit
+     */
+    virtual Result<std::size_t> MaxBindParameters() = 0;
+
     Connection() = default;
 
     virtual ~Connection() = default;
@@ -6,6 +6,9 @@
 #ifndef EVGET_DATABASE_QUERY_H
 #define EVGET_DATABASE_QUERY_H
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <string>
 
 #include "evget/error.h"
@@ -13,7 +16,8 @@
 namespace evget {
 
 /**
- * \brief An interface representing a query.
+ * \brief An interface representing a query. Values are bound immediately and copied by the implementation,
+ *        and any error that occurs while binding is returned by the next call to `Next`.
  */
 class Query {
 public:
@@ -22,6 +26,11 @@ public:
      */
     virtual void BindInt(int position, int value) = 0;
 
+    /**
+     * \brief Bind a 64-bit integer to the position.
+     */
+    virtual void BindInt64(int position, std::int64_t value) = 0;
+
     /**
      * \brief Bind a double to the position.
      */
@@ -32,11 +41,26 @@ public:
      */
     virtual void BindChars(int position, const char* value) = 0;
 
+    /**
+     * \brief Bind a character array to the position without copying it. The array must outlive the query.
+     */
+    virtual void BindStaticChars(int position, const char* value) = 0;
+
     /**
      * \brief Bind a boolean to the position.
      */
     virtual void BindBool(int position, bool value) = 0;
 
+    /**
+     * \brief Bind a null value to the position.
+     */
+    virtual void BindNull(int position) = 0;
+
+    /**
+     * \brief Bind a blob to the position.
+     */
+    virtual void BindBlob(int position, std::span<const std::byte> value) = 0;
+
     /**
      * \brief Reset this query. This should not reset a transaction.
      */
@@ -9,6 +9,7 @@
 #include <SQLiteCpp/Database.h>
 #include <SQLiteCpp/Transaction.h>
 
+#include <cstddef>
 #include <filesystem>
 #include <functional>
 #include <memory>
@@ -17,6 +18,7 @@
 
 #include "evget/database/connection.h"
 #include "evget/database/query.h"
+#include "evget/database/sqlite/tuning.h"
 #include "evget/error.h"
 
 namespace evget {
@@ -32,7 +34,13 @@ public:
     SQLiteConnection() = default;
 
     /**
-     * \brief Connect to an SQLite database.
+     * \brief Create an SQLiteConnection which applies pragma settings whenever it connects.
+     * \param tuning pragma settings
+     */
+    explicit SQLiteConnection(SQLiteTuning tuning);
+
+    /**
+     * \brief Connect to an SQLite database and apply the tuning pragmas.
      * \param database path to the SQLite database file
      * \param options connection options
      * \return result indicating success or failure
@@ -64,6 +72,13 @@ public:
      */
     std::unique_ptr<Query> BuildQuery(std::string query) override;
 
+    /**
+     * \brief Get the maximum number of host parameters allowed in a single statement, from
+     *        `SQLITE_LIMIT_VARIABLE_NUMBER`.
+     * \return result containing the parameter limit
+     */
+    Result<std::size_t> MaxBindParameters() override;
+
     /**
      * \brief Get the underlying database.
      * \return the database
@@ -73,6 +88,7 @@ public:
 private:
     std::optional<SQLite::Database> database_;
     std::optional<SQLite::Transaction> transaction_;
+    SQLiteTuning tuning_;
 
     static Err ConnectError(const char* message);
 };
@@ -8,12 +8,13 @@
 
 #include <SQLiteCpp/Statement.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
-#include <map>
 #include <optional>
+#include <span>
 #include <string>
-#include <variant>
 
 #include "evget/database/query.h"
 #include "evget/database/sqlite/connection.h"
@@ -39,6 +40,13 @@ public:
      */
     void BindInt(int position, int value) override;
 
+    /**
+     * \brief Bind a 64-bit integer value to a parameter position.
+     * \param position parameter position (0-based)
+     * \param value integer value to bind
+     */
+    void BindInt64(int position, std::int64_t value) override;
+
     /**
      * \brief Bind a double value to a parameter position.
      * \param position parameter position (0-based)
@@ -53,6 +61,13 @@ public:
      */
     void BindChars(int position, const char* value) override;
 
+    /**
+     * \brief Bind a character array to a parameter position without copying it.
+     * \param position parameter position (0-based)
+     * \param value character array to bind, which must outlive the query
+     */
+    void BindStaticChars(int position, const char* value) override;
+
     /**
      * \brief Bind a boolean value to a parameter position.
      * \param position parameter position (0-based)
@@ -60,6 +75,19 @@ public:
      */
     void BindBool(int position, bool value) override;
 
+    /**
+     * \brief Bind a null value to a parameter position.
+     * \param position parameter position (0-based)
+     */
+    void BindNull(int position) override;
+
+    /**
+     * \brief Bind a blob to a parameter position.
+     * \param position parameter position (0-based)
+     * \param value bytes to bind
+     */
+    void BindBlob(int position, std::span<const std::byte> value) override;
+
     /**
      * \brief Reset the query to its initial state.
      * \return result indicating success or failure
@@ -116,9 +144,13 @@ private:
     static Err AsError(const std::exception& error);
     static Err StatementError();
 
+    Result<std::reference_wrapper<::SQLite::Statement>> PrepareStatement();
+    template <bool NoCopy = false, typename... T>
+    void Bind(int position, T... value);
+
     std::reference_wrapper<SQLiteConnection> connection_;
-    std::map<int, std::variant<int, double, const char*, bool>> binds_;
     std::optional<::SQLite::Statement> statement_;
+    std::optional<Error<ErrorType>> bind_error_;
     std::string query_;
 };
 
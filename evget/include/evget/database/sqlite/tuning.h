@@ -0,0 +1,81 @@
+/**
+ * \file tuning.h
+ * \brief SQLite pragma settings applied when opening a connection.
+ */
+
+#ifndef EVGET_DATABASE_SQLITE_TUNING_H
+#define EVGET_DATABASE_SQLITE_TUNING_H
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace evget {
+
+/**
+ * \brief A named set of SQLite settings.
+ */
+enum class SQLiteProfile : std::uint8_t {
+    kDefault, ///< leave SQLite defaults unchanged
+    kThroughput, ///< WAL with `synchronous=NORMAL`, a large cache and memory mapped IO; a power loss may lose the
+                 ///< most recent transactions but never corrupts the database
+    kDurable, ///< WAL with `synchronous=FULL`; every committed transaction is synced to disk
+};
+
+/**
+ * \brief The SQLite journal mode.
+ */
+enum class SQLiteJournalMode : std::uint8_t {
+    kDelete, ///< rollback journal deleted after each transaction
+    kWal, ///< write-ahead log, which allows readers to run concurrently with a writer
+};
+
+/**
+ * \brief The SQLite synchronous level.
+ */
+enum class SQLiteSynchronous : std::uint8_t {
+    kOff, ///< never sync
+    kNormal, ///< sync at checkpoints only when using WAL
+    kFull, ///< sync on every commit
+    kExtra, ///< sync on every commit and the directory on journal deletion
+};
+
+/**
+ * \brief Where SQLite stores temporary tables and indices.
+ */
+enum class SQLiteTempStore : std::uint8_t {
+    kDefault, ///< compile time default
+    kFile, ///< use a file
+    kMemory, ///< use memory
+};
+
+/**
+ * \brief Pragma settings applied by an `SQLiteConnection` after it opens a database. Unset values are left at
+ *        the SQLite defaults.
+ */
+struct SQLiteTuning {
+    std::optional<SQLiteJournalMode> journal_mode; ///< journal mode, persisted in the database file
+    std::optional<SQLiteSynchronous> synchronous; ///< synchronous level
+    std::optional<std::int64_t> cache_size; ///< cache size, in pages if positive or in KiB if negative
+    std::optional<std::int64_t> page_size; ///< page size in bytes, only effective for new databases
+    std::optional<std::int64_t> mmap_size; ///< maximum number of bytes to memory map
+    std::optional<SQLiteTempStore> temp_store; ///< temporary storage location
+
+    /**
+     * \brief Get the settings for a profile.
+     * \param profile the profile
+     * \return the tuning settings
+     */
+    static SQLiteTuning FromProfile(SQLiteProfile profile);
+
+    /**
+     * \brief Get the pragma statements for these settings, in the order they should be applied.
+     * \param read_only whether the connection is read-only, which skips pragmas that write to the database
+     * \return pragma statements
+     */
+    [[nodiscard]] std::vector<std::string> Pragmas(bool read_only) const;
+};
+} // namespace evget
+
+#endif
@@ -9,9 +9,10 @@
 #include <boost/uuid/random_generator.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
-#include <string>
 #include <unordered_map>
 
+#include "evget/event/interned_string.h"
+
 namespace evget {
 
 /**
@@ -24,19 +25,19 @@ public:
     /**
      * \brief Get the UUID for a device, generating one on first access.
      * \param key the device identifier
-     * \return reference to the device UUID string
+     * \return the interned device UUID
      */
-    const std::string& Uuid(Key key);
+    InternedString Uuid(Key key);
 
 private:
-    std::unordered_map<Key, std::string> device_uuids_;
+    std::unordered_map<Key, InternedString> device_uuids_;
 };
 
 template <typename Key>
-const std::string& DeviceId<Key>::Uuid(Key key) {
+InternedString DeviceId<Key>::Uuid(Key key) {
     auto [iterator, inserted] = device_uuids_.try_emplace(key);
     if (inserted) {
-        iterator->second = boost::uuids::to_string(boost::uuids::random_generator()());
+        iterator->second = InternedString{boost::uuids::to_string(boost::uuids::random_generator()())};
     }
     return iterator->second;
 }
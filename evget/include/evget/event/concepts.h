@@ -10,6 +10,7 @@
 #include <optional>
 #include <string>
 
+#include "evget/event/interned_string.h"
 #include "evget/event/modifier_value.h"
 #include "evget/event/schema.h"
 
@@ -26,7 +27,7 @@ concept BuilderHasModifier = requires(T builder, ModifierValue modifier_value) {
  * \brief Checks whether the template is a builder with the `ButtonName` function.
  */
 template <typename T>
-concept BuilderHasButtonName = requires(T builder, std::string name) {
+concept BuilderHasButtonName = requires(T builder, InternedString name) {
     { builder.ButtonName(std::move(name)) } -> std::convertible_to<T>;
 };
 
@@ -34,7 +35,7 @@ concept BuilderHasButtonName = requires(T builder, std::string name) {
  * \brief Checks whether the template is a builder with the `DeviceName` function.
  */
 template <typename T>
-concept BuilderHasDeviceName = requires(T builder, std::string name) {
+concept BuilderHasDeviceName = requires(T builder, InternedString name) {
     { builder.DeviceName(std::move(name)) } -> std::convertible_to<T>;
 };
 
@@ -47,8 +48,8 @@ concept BuilderHasBaseFields = evget::BuilderHasModifier<T> && evget::BuilderHas
              TimestampType timestamp,
              std::optional<IntervalType> interval,
              DeviceType device,
-             std::string name,
-             std::string device_id) {
+             InternedString name,
+             InternedString device_id) {
         { builder.Timestamp(timestamp) } -> std::convertible_to<T>;
         { builder.Interval(interval) } -> std::convertible_to<T>;
         { builder.Device(device) } -> std::convertible_to<T>;
@@ -6,17 +6,55 @@
 #ifndef EVGET_EVENT_DATA_H
 #define EVGET_EVENT_DATA_H
 
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <utility>
 #include <vector>
 
 #include "evget/event/entry.h"
+#include "evget/event/modifier_value.h"
 
 namespace evget {
 /**
  * \brief Data represents the actual entries that are generated from device events. The order
  *        of the entries defines the final insertion order in the storage component.
+ *
+ * Data can be created with an arena, which the data values of entries added with `AddEntry` are allocated from. The
+ * data keeps the arena, and the arenas of any data merged into it, alive while it exists, so the arena is released
+ * once all data referring to it is destroyed. An arena is not synchronized, so entries should only be added to data
+ * sharing an arena from one thread at a time. Copies of data use the default memory resource and keep no arena alive.
  */
 class Data {
 public:
+    /**
+     * \brief Create empty data using the default memory resource.
+     */
+    Data() = default;
+
+    /**
+     * \brief Create empty data which allocates the data values of added entries from the arena.
+     * \param arena arena to allocate from, or null to use the default memory resource
+     */
+    explicit Data(std::shared_ptr<std::pmr::memory_resource> arena);
+
+    ~Data() = default;
+
+    /**
+     * \brief Copy the entries, allocating their data values from the default memory resource.
+     */
+    Data(const Data& other);
+
+    /**
+     * \brief Copy the entries, keeping the arenas of this data. Existing entries keep their memory resource.
+     */
+    Data& operator=(const Data& other);
+
+    Data(Data&&) noexcept = default;
+    Data& operator=(Data&&) noexcept = default;
+
     /**
      * \brief Get a reference to the entries.
      * \return Entries reference
@@ -24,13 +62,15 @@ public:
     [[nodiscard]] const std::vector<Entry>& Entries() const;
 
     /**
-     * \brief Merge with another data object by extending the entries of this object.
+     * \brief Merge with another data object by extending the entries of this object. Entries are moved without
+     *        copying their data values, and this object keeps the arenas of the other object alive.
      * \param data the data object to merge with
      */
     void MergeWith(Data&& data);
 
     /**
-     * \brief Take the entries out of this object
+     * \brief Take the entries out of this object. Entries allocated from an arena are copied to the default memory
+     *        resource, since the arena is not kept alive by the entries alone.
      * \return Entries moved out of an object
      */
     std::vector<Entry> IntoEntries() &&;
@@ -41,6 +81,41 @@ public:
      */
     void AddEntry(Entry entry);
 
+    /**
+     * \brief Add an entry, allocating its data values from this object's arena.
+     * \param type type of the entry
+     * \param data data values of the entry
+     * \param modifiers modifier values of the entry
+     */
+    void AddEntry(EntryType type, std::initializer_list<FieldValue> data, ModifierSet modifiers);
+
+    /**
+     * \brief Remove the entries that match a predicate, keeping the order of the others. Kept entries are moved
+     *        without copying their data values. The predicate is called once for each entry, in order.
+     * \param predicate returns true for entries to remove
+     */
+    void EraseIf(std::invocable<const Entry&> auto&& predicate);
+
+    /**
+     * \brief Reserve space for entries.
+     * \param n_entries the total number of entries to reserve space for
+     */
+    void Reserve(std::size_t n_entries);
+
+    /**
+     * \brief Get the number of entries.
+     * \return number of entries
+     */
+    [[nodiscard]] std::size_t Size() const;
+
+    /**
+     * \brief Get the approximate number of bytes allocated for the entries and their data values. Owned strings
+     *        count their heap capacity, while interned strings and strings within the small string buffer are not
+     *        counted.
+     * \return number of bytes
+     */
+    [[nodiscard]] std::size_t Footprint() const;
+
     /**
      * \brief If there are any entries in this data.
      * \return boolean indicating emptiness
@@ -48,8 +123,26 @@ public:
     [[nodiscard]] bool Empty() const;
 
 private:
+    [[nodiscard]] std::pmr::memory_resource* Resource() const;
+    void Retain(std::shared_ptr<std::pmr::memory_resource> arena);
+
     std::vector<Entry> entries_;
+    std::shared_ptr<std::pmr::memory_resource> arena_;
+    std::vector<std::shared_ptr<std::pmr::memory_resource>> retained_;
 };
+
+void Data::EraseIf(std::invocable<const Entry&> auto&& predicate) {
+    // Move the kept entries into a new vector, since move assigning an entry would copy its data values when the
+    // memory resources differ.
+    std::vector<Entry> kept{};
+    kept.reserve(entries_.size());
+    for (auto& entry : entries_) {
+        if (!predicate(std::as_const(entry))) {
+            kept.push_back(std::move(entry));
+        }
+    }
+    entries_ = std::move(kept);
+}
 } // namespace evget
 
 #endif
@@ -8,15 +8,47 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <memory_resource>
 #include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
+#include <variant>
 #include <vector>
 
+#include "evget/event/button_action.h"
+#include "evget/event/device_type.h"
+#include "evget/event/interned_string.h"
+#include "evget/event/modifier_value.h"
+
 namespace evget {
 
+/// \brief Type alias for time intervals in microseconds.
+using IntervalType = std::chrono::microseconds;
+
+/// \brief Type alias for system clock time points.
+using TimestampType = std::chrono::time_point<std::chrono::system_clock>;
+
+/**
+ * \brief A single typed field value of an entry. `std::monostate` represents a field that was not set.
+ *        Values are kept in their native representation and are only formatted by text based storage. Strings
+ *        with few distinct values are interned, so entries reference repeated values such as device names instead
+ *        of copying them. Strings with unbounded distinct values, such as window names, are owned by the entry.
+ */
+using FieldValue = std::variant<
+    std::monostate,
+    std::int64_t,
+    double,
+    InternedString,
+    std::string,
+    IntervalType,
+    TimestampType,
+    DeviceType,
+    ButtonAction>;
+
 namespace detail {
 /// \brief Number of fields common to all events.
 constexpr auto kBaseNFields = 15;
@@ -134,17 +166,18 @@ enum class EntryType : std::uint8_t {
 };
 
 /**
- * \brief An entry with its associated field names for easier processing.
+ * \brief An entry formatted as strings with its associated field names for text based processing.
  */
 struct EntryWithFields {
     EntryType type; ///< Type of the entry
     std::vector<std::string> fields; ///< Field names for the data
-    std::vector<std::string> data; ///< Actual data values
-    std::vector<std::string> modifiers; ///< Modifier values
+    std::vector<std::string> data; ///< Formatted data values
+    std::vector<std::string> modifiers; ///< Formatted modifier values
 };
 
 /**
- * \brief An entry contains data, modifiers, and its type.
+ * \brief An entry contains data, modifiers, and its type. The data values may be allocated from an arena, which the
+ *        `Data` holding the entry keeps alive. Copies of an entry allocate their data values from the default resource.
  */
 class Entry {
 public:
@@ -154,7 +187,7 @@ public:
      * \param data Data values for the entry
      * \param modifiers Modifier values for the entry
      */
-    Entry(EntryType type, const std::vector<std::string>& data, std::vector<std::string> modifiers);
+    Entry(EntryType type, std::pmr::vector<FieldValue> data, ModifierSet modifiers);
 
     /**
      * \brief Get the type of this entry.
@@ -166,28 +199,30 @@ public:
      * \brief Get the data values of this entry.
      * \return Reference to data vector
      */
-    [[nodiscard]] const std::vector<std::string>& Data() const;
+    [[nodiscard]] const std::pmr::vector<FieldValue>& Data() const;
 
     /**
      * \brief Get the modifier values of this entry.
-     * \return Reference to modifiers vector
+     * \return Set of active modifiers
      */
-    [[nodiscard]] const std::vector<std::string>& Modifiers() const;
+    [[nodiscard]] ModifierSet Modifiers() const;
 
     /**
-     * \brief Convert enum integer fields to named string representations for display.
+     * \brief Get the field names for the type of this entry, in the same order as the data values.
+     * \return View of the constant field names
      */
-    void ToNamedRepresentation();
+    [[nodiscard]] std::span<const std::string_view> FieldNames() const;
 
     /**
-     * \brief Get the entry with fields.
+     * \brief Get the entry with fields, formatting data and modifiers as strings. Enum fields use their
+     *        named representation.
      */
     [[nodiscard]] EntryWithFields GetEntryWithFields() const;
 
 private:
     EntryType type_;
-    std::vector<std::string> data_;
-    std::vector<std::string> modifiers_;
+    std::pmr::vector<FieldValue> data_;
+    ModifierSet modifiers_;
 };
 
 } // namespace evget
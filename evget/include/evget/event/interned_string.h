@@ -0,0 +1,148 @@
+/**
+ * \file interned_string.h
+ * \brief Process-wide pool of immutable strings referenced by lightweight handles.
+ */
+
+#ifndef EVGET_EVENT_INTERNED_STRING_H
+#define EVGET_EVENT_INTERNED_STRING_H
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iosfwd>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace evget {
+
+/**
+ * \brief A handle to an immutable string in the process-wide `StringPool`. Copying a handle never copies or
+ *        allocates the string, and two handles are equal exactly when their strings are equal.
+ *
+ * Constructing a handle from a string interns it, which hashes the string under the pool lock and only allocates the
+ * first time a distinct string is seen. Strings are never freed, so only values with few distinct strings, such as
+ * device names, event sources and key names, should be interned, and the handle kept rather than interning the value
+ * again for each event. Unbounded values such as window names should remain owned strings.
+ */
+class InternedString {
+public:
+    /**
+     * \brief Create a handle to the empty string without touching the pool.
+     */
+    InternedString() = default;
+
+    /**
+     * \brief Intern a string.
+     * \param value the string to intern
+     */
+    explicit InternedString(std::string_view value);
+
+    /**
+     * \brief Intern a string.
+     * \param value the null-terminated string to intern
+     */
+    explicit InternedString(const char* value);
+
+    /**
+     * \brief Intern a string.
+     * \param value the string to intern
+     */
+    explicit InternedString(const std::string& value);
+
+    /**
+     * \brief Get the string. The view is null-terminated and valid for the lifetime of the process.
+     * \return the string
+     */
+    [[nodiscard]] std::string_view View() const;
+
+    /**
+     * \brief Get the id of the string, which is unique within the process and assigned in interning order,
+     *        starting with zero for the empty string. Sinks can use this to write each distinct string once.
+     * \return the id
+     */
+    [[nodiscard]] std::uint32_t Id() const;
+
+    /**
+     * \brief Compare two handles by id.
+     */
+    bool operator==(const InternedString& other) const;
+
+    /**
+     * \brief Compare the string of a handle with another string without interning it.
+     */
+    bool operator==(std::string_view other) const;
+
+    /**
+     * \brief Order two handles by id, which is not the lexicographic order of the strings.
+     */
+    std::strong_ordering operator<=>(const InternedString& other) const;
+
+private:
+    friend class StringPool;
+
+    InternedString(std::uint32_t id, std::string_view value);
+
+    std::string_view value_{""};
+    std::uint32_t id_{0};
+};
+
+/**
+ * \brief Write the string of a handle to a stream.
+ * \param ostream the stream to write to
+ * \param value the handle to write
+ * \return the stream
+ */
+std::ostream& operator<<(std::ostream& ostream, const InternedString& value);
+
+/**
+ * \brief A thread-safe pool of strings which are never freed, so that views into it remain valid for the lifetime
+ *        of the process. The pool grows with the number of distinct strings rather than the number of events, so it
+ *        must only hold values with a small number of distinct strings.
+ */
+class StringPool {
+public:
+    /**
+     * \brief Get the process-wide pool.
+     * \return the pool
+     */
+    static StringPool& Global();
+
+    /**
+     * \brief Intern a string, copying it into the pool if it has not been seen before.
+     * \param value the string to intern
+     * \return a handle to the pooled string
+     */
+    InternedString Intern(std::string_view value);
+
+    /**
+     * \brief Get the number of distinct strings in the pool.
+     * \return the number of strings
+     */
+    [[nodiscard]] std::size_t Size() const;
+
+private:
+    StringPool();
+
+    mutable std::shared_mutex mutex_;
+    // A deque never moves its elements, so views into the strings stay valid as it grows.
+    std::deque<std::string> strings_;
+    std::unordered_map<std::string_view, std::uint32_t> ids_;
+};
+
+} // namespace evget
+
+/**
+ * \brief Hash an interned string by its id.
+ */
+template <>
+struct std::hash<evget::InternedString> {
+    std::size_t operator()(const evget::InternedString& value) const noexcept {
+        return std::hash<std::uint32_t>{}(value.Id());
+    }
+};
+
+#endif
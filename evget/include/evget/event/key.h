@@ -8,11 +8,11 @@
 
 #include <optional>
 #include <string>
-#include <vector>
 
 #include "evget/event/button_action.h"
 #include "evget/event/data.h"
 #include "evget/event/device_type.h"
+#include "evget/event/interned_string.h"
 #include "evget/event/modifier_value.h"
 #include "evget/event/schema.h"
 
@@ -83,21 +83,21 @@ public:
      * \param name button name
      * \return reference to this `Key` object
      */
-    Key& ButtonName(std::string name);
+    Key& ButtonName(InternedString name);
 
     /**
      * \brief Add character.
      * \param character character representation of the key
      * \return reference to this `Key` object
      */
-    Key& Character(std::string character);
+    Key& Character(InternedString character);
 
     /**
      * \brief Add the device name.
      * \param device_name name of the input device
      * \return reference to this `Key` object
      */
-    Key& DeviceName(std::string device_name);
+    Key& DeviceName(InternedString device_name);
 
     /**
      * \brief Add the focus window name.
@@ -153,21 +153,21 @@ public:
      * \param device_id unique device identifier
      * \return reference to this `Key` object
      */
-    Key& DeviceId(std::string device_id);
+    Key& DeviceId(InternedString device_id);
 
     /**
      * \brief Add the system event name.
      * \param system_event name of the underlying system event
      * \return reference to this `Key` object
      */
-    Key& SystemEvent(std::string system_event);
+    Key& SystemEvent(InternedString system_event);
 
     /**
      * \brief Add the event source.
      * \param event_source name of the backend that produced this event
      * \return reference to this `Key` object
      */
-    Key& EventSource(std::string event_source);
+    Key& EventSource(InternedString event_source);
 
     /**
      * \brief Build key event.
@@ -182,22 +182,22 @@ private:
     std::optional<DeviceType> device_;
     std::optional<double> position_x_;
     std::optional<double> position_y_;
-    std::optional<std::string> device_id_;
+    std::optional<InternedString> device_id_;
     std::optional<ButtonAction> action_;
     std::optional<int> button_;
-    std::optional<std::string> name_;
-    std::optional<std::string> character_;
-    std::optional<std::string> device_name_;
+    std::optional<InternedString> name_;
+    std::optional<InternedString> character_;
+    std::optional<InternedString> device_name_;
     std::optional<std::string> focus_window_name_;
     std::optional<double> focus_window_position_x_;
     std::optional<double> focus_window_position_y_;
     std::optional<double> focus_window_width_;
     std::optional<double> focus_window_height_;
     std::optional<int> screen_;
-    std::optional<std::string> system_event_;
-    std::optional<std::string> event_source_;
+    std::optional<InternedString> system_event_;
+    std::optional<InternedString> event_source_;
 
-    std::vector<std::string> modifiers_;
+    ModifierSet modifiers_;
 };
 } // namespace evget
 
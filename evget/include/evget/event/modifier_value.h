@@ -6,7 +6,12 @@
 #ifndef EVGET_EVENT_MODIFIER_VALUE_H
 #define EVGET_EVENT_MODIFIER_VALUE_H
 
+#include <bit>
+#include <cstddef>
 #include <cstdint>
+#include <initializer_list>
+#include <ranges>
+#include <utility>
 
 namespace evget {
 /**
@@ -22,6 +27,106 @@ enum class ModifierValue : std::uint8_t {
     kSuper, ///< Super key modifier (X11/Wayland: Mod4, Mac: Command, Windows: Windows key)
     kMod5 ///< Generic modifier 5 (X11/Wayland: Mod5)
 };
+
+/**
+ * \brief A set of modifiers stored as a bitmask, where bit `n` is set when the modifier with underlying value `n`
+ *        is active. The set is a single byte, so entries carry their modifiers without allocating.
+ */
+class ModifierSet {
+public:
+    /**
+     * \brief Create an empty set.
+     */
+    constexpr ModifierSet() = default;
+
+    /**
+     * \brief Create a set containing the modifiers.
+     * \param modifiers modifiers in the set
+     */
+    constexpr ModifierSet(std::initializer_list<ModifierValue> modifiers) {
+        for (auto modifier : modifiers) {
+            Insert(modifier);
+        }
+    }
+
+    /**
+     * \brief Create a set from its bitmask.
+     * \param bits the bitmask
+     * \return the set
+     */
+    static constexpr ModifierSet FromBits(std::uint8_t bits) {
+        ModifierSet set{};
+        set.bits_ = bits;
+        return set;
+    }
+
+    /**
+     * \brief Add a modifier to the set.
+     * \param modifier modifier to add
+     * \return reference to this set
+     */
+    constexpr ModifierSet& Insert(ModifierValue modifier) {
+        bits_ |= Bit(modifier);
+        return *this;
+    }
+
+    /**
+     * \brief Check whether the set contains a modifier.
+     * \param modifier modifier to check
+     * \return true if the modifier is in the set
+     */
+    [[nodiscard]] constexpr bool Contains(ModifierValue modifier) const {
+        return (bits_ & Bit(modifier)) != 0;
+    }
+
+    /**
+     * \brief Get the bitmask of the set.
+     * \return the bitmask
+     */
+    [[nodiscard]] constexpr std::uint8_t Bits() const {
+        return bits_;
+    }
+
+    /**
+     * \brief Get the number of modifiers in the set.
+     * \return the number of modifiers
+     */
+    [[nodiscard]] constexpr std::size_t Size() const {
+        return static_cast<std::size_t>(std::popcount(bits_));
+    }
+
+    /**
+     * \brief Check whether the set is empty.
+     * \return true if no modifiers are set
+     */
+    [[nodiscard]] constexpr bool Empty() const {
+        return bits_ == 0;
+    }
+
+    /**
+     * \brief Get the modifiers in the set in order of their underlying value, without allocating.
+     * \return a view of the modifiers
+     */
+    [[nodiscard]] constexpr auto Values() const {
+        return std::views::iota(0, kNModifiers) |
+               std::views::filter([bits = bits_](int bit) { return (bits & (1U << bit)) != 0; }) |
+               std::views::transform([](int bit) { return static_cast<ModifierValue>(bit); });
+    }
+
+    /**
+     * \brief Compare two sets.
+     */
+    constexpr bool operator==(const ModifierSet& other) const = default;
+
+private:
+    static constexpr int kNModifiers = 8;
+
+    static constexpr std::uint8_t Bit(ModifierValue modifier) {
+        return static_cast<std::uint8_t>(1U << std::to_underlying(modifier));
+    }
+
+    std::uint8_t bits_{0};
+};
 } // namespace evget
 
 #endif
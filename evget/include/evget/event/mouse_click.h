@@ -8,11 +8,11 @@
 
 #include <optional>
 #include <string>
-#include <vector>
 
 #include "evget/event/button_action.h"
 #include "evget/event/data.h"
 #include "evget/event/device_type.h"
+#include "evget/event/interned_string.h"
 #include "evget/event/modifier_value.h"
 #include "evget/event/schema.h"
 
@@ -83,14 +83,14 @@ public:
      * \param name button name
      * \return reference to this `MouseClick` object
      */
-    MouseClick& ButtonName(std::string name);
+    MouseClick& ButtonName(InternedString name);
 
     /**
      * \brief Add the device name.
      * \param device_name name of the input device
      * \return reference to this `MouseClick` object
      */
-    MouseClick& DeviceName(std::string device_name);
+    MouseClick& DeviceName(InternedString device_name);
 
     /**
      * \brief Add the focus window name.
@@ -146,7 +146,7 @@ public:
      * \param device_id unique device identifier
      * \return reference to this `MouseClick` object
      */
-    MouseClick& DeviceId(std::string device_id);
+    MouseClick& DeviceId(InternedString device_id);
 
     /**
      * \brief Add touch point identifier.
@@ -160,14 +160,14 @@ public:
      * \param system_event name of the underlying system event
      * \return reference to this `MouseClick` object
      */
-    MouseClick& SystemEvent(std::string system_event);
+    MouseClick& SystemEvent(InternedString system_event);
 
     /**
      * \brief Add the event source.
      * \param event_source name of the backend that produced this event
      * \return reference to this `MouseClick` object
      */
-    MouseClick& EventSource(std::string event_source);
+    MouseClick& EventSource(InternedString event_source);
 
     /**
      * \brief Build mouse click event.
@@ -182,11 +182,11 @@ private:
     std::optional<DeviceType> device_;
     std::optional<double> position_x_;
     std::optional<double> position_y_;
-    std::optional<std::string> device_id_;
+    std::optional<InternedString> device_id_;
     std::optional<ButtonAction> action_;
     std::optional<int> button_;
-    std::optional<std::string> name_;
-    std::optional<std::string> device_name_;
+    std::optional<InternedString> name_;
+    std::optional<InternedString> device_name_;
     std::optional<std::string> focus_window_name_;
     std::optional<double> focus_window_position_x_;
     std::optional<double> focus_window_position_y_;
@@ -194,10 +194,10 @@ private:
     std::optional<double> focus_window_height_;
     std::optional<int> screen_;
     std::optional<int> touch_id_;
-    std::optional<std::string> system_event_;
-    std::optional<std::string> event_source_;
+    std::optional<InternedString> system_event_;
+    std::optional<InternedString> event_source_;
 
-    std::vector<std::string> modifiers_;
+    ModifierSet modifiers_;
 };
 } // namespace evget
 
@@ -8,10 +8,10 @@
 
 #include <optional>
 #include <string>
-#include <vector>
 
 #include "evget/event/data.h"
 #include "evget/event/device_type.h"
+#include "evget/event/interned_string.h"
 #include "evget/event/modifier_value.h"
 #include "evget/event/schema.h"
 
@@ -68,7 +68,7 @@ public:
      * \param device_name name of the input device
      * \return reference to this `MouseMove` object
      */
-    MouseMove& DeviceName(std::string device_name);
+    MouseMove& DeviceName(InternedString device_name);
 
     /**
      * \brief Add the focus window name.
@@ -124,7 +124,7 @@ public:
      * \param device_id unique device identifier
      * \return reference to this `MouseMove` object
      */
-    MouseMove& DeviceId(std::string device_id);
+    MouseMove& DeviceId(InternedString device_id);
 
     /**
      * \brief Add touch point identifier.
@@ -138,14 +138,14 @@ public:
      * \param system_event name of the underlying system event
      * \return reference to this `MouseMove` object
      */
-    MouseMove& SystemEvent(std::string system_event);
+    MouseMove& SystemEvent(InternedString system_event);
 
     /**
      * \brief Add the event source.
      * \param event_source name of the backend that produced this event
      * \return reference to this `MouseMove` object
      */
-    MouseMove& EventSource(std::string event_source);
+    MouseMove& EventSource(InternedString event_source);
 
     /**
      * \brief Build mouse move event.
@@ -160,8 +160,8 @@ private:
     std::optional<DeviceType> device_;
     std::optional<double> position_x_;
     std::optional<double> position_y_;
-    std::optional<std::string> device_id_;
-    std::optional<std::string> device_name_;
+    std::optional<InternedString> device_id_;
+    std::optional<InternedString> device_name_;
     std::optional<std::string> focus_window_name_;
     std::optional<double> focus_window_position_x_;
     std::optional<double> focus_window_position_y_;
@@ -169,10 +169,10 @@ private:
     std::optional<double> focus_window_height_;
     std::optional<int> screen_;
     std::optional<int> touch_id_;
-    std::optional<std::string> system_event_;
-    std::optional<std::string> event_source_;
+    std::optional<InternedString> system_event_;
+    std::optional<InternedString> event_source_;
 
-    std::vector<std::string> modifiers_;
+    ModifierSet modifiers_;
 };
 } // namespace evget
 
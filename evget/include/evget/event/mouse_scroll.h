@@ -8,10 +8,10 @@
 
 #include <optional>
 #include <string>
-#include <vector>
 
 #include "evget/event/data.h"
 #include "evget/event/device_type.h"
+#include "evget/event/interned_string.h"
 #include "evget/event/modifier_value.h"
 #include "evget/event/schema.h"
 
@@ -82,7 +82,7 @@ public:
      * \param device_name name of the input device
      * \return reference to this `MouseScroll` object
      */
-    MouseScroll& DeviceName(std::string device_name);
+    MouseScroll& DeviceName(InternedString device_name);
 
     /**
      * \brief Add the focus window name.
@@ -138,21 +138,21 @@ public:
      * \param device_id unique device identifier
      * \return reference to this `MouseScroll` object
      */
-    MouseScroll& DeviceId(std::string device_id);
+    MouseScroll& DeviceId(InternedString device_id);
 
     /**
      * \brief Add the system event name.
      * \param system_event name of the underlying system event
      * \return reference to this `MouseScroll` object
      */
-    MouseScroll& SystemEvent(std::string system_event);
+    MouseScroll& SystemEvent(InternedString system_event);
 
     /**
      * \brief Add the event source.
      * \param event_source name of the backend that produced this event
      * \return reference to this `MouseScroll` object
      */
-    MouseScroll& EventSource(std::string event_source);
+    MouseScroll& EventSource(InternedString event_source);
 
     /**
      * \brief Build mouse wheel event.
@@ -167,20 +167,20 @@ private:
     std::optional<DeviceType> device_;
     std::optional<double> position_x_;
     std::optional<double> position_y_;
-    std::optional<std::string> device_id_;
+    std::optional<InternedString> device_id_;
     std::optional<double> vertical_;
     std::optional<double> horizontal_;
-    std::optional<std::string> device_name_;
+    std::optional<InternedString> device_name_;
     std::optional<std::string> focus_window_name_;
     std::optional<double> focus_window_position_x_;
     std::optional<double> focus_window_position_y_;
     std::optional<double> focus_window_width_;
     std::optional<double> focus_window_height_;
     std::optional<int> screen_;
-    std::optional<std::string> system_event_;
-    std::optional<std::string> event_source_;
+    std::optional<InternedString> system_event_;
+    std::optional<InternedString> event_source_;
 
-    std::vector<std::string> modifiers_;
+    ModifierSet modifiers_;
 };
 } // namespace evget
 
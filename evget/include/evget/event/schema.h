@@ -14,16 +14,18 @@
 #include <cstdint>
 #include <format>
 #include <optional>
-#include <sstream>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "evget/error.h"
 #include "evget/event/button_action.h"
 #include "evget/event/device_type.h"
 #include "evget/event/entry.h"
+#include "evget/event/interned_string.h"
 #include "evget/event/modifier_value.h"
 #include "evget/util.h"
 
@@ -129,12 +131,6 @@ enum class DataType : std::uint8_t {
     kDouble ///< A double type
 };
 
-/// \brief Type alias for time intervals in microseconds.
-using IntervalType = std::chrono::microseconds;
-
-/// \brief Type alias for system clock time points.
-using TimestampType = std::chrono::time_point<std::chrono::system_clock>;
-
 /// \brief Get the current timestamp at this moment using system time.
 inline TimestampType Now() {
     return std::chrono::system_clock::now();
@@ -296,12 +292,19 @@ constexpr std::string FromInt(std::optional<int> value) {
 constexpr std::string FromTimestamp(const std::optional<TimestampType> optional) {
     return detail::OptionalToString(optional, [](auto value) {
         auto nanoseconds = std::chrono::time_point_cast<std::chrono::nanoseconds>(value);
-        std::stringstream stream{};
-        stream << std::format("{:%Y-%m-%dT%H:%M:%S%z}", nanoseconds);
-        return stream.str();
+        return std::format("{:%Y-%m-%dT%H:%M:%S%z}", nanoseconds);
     });
 }
 
+/**
+ * \brief Convert a timestamp to the number of microseconds since the Unix epoch.
+ * \param timestamp timestamp value
+ * \return microseconds since the epoch
+ */
+constexpr std::int64_t ToEpochMicroseconds(TimestampType timestamp) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(timestamp.time_since_epoch()).count();
+}
+
 /**
  * \brief Format a string from an optional `ButtonAction` value.
  * \param optional optional button action value
@@ -432,6 +435,62 @@ constexpr std::string FromInterval(const std::optional<IntervalType> optional) {
 constexpr std::string FromDouble(const std::optional<double> optional) {
     return detail::OptionalToString(optional, [](auto value) { return std::to_string(value); });
 }
+
+/**
+ * \brief Convert an optional value into a `FieldValue`.
+ * \tparam T value type, which must be one of the `FieldValue` alternatives
+ * \param optional optional value
+ * \return the field value, or `std::monostate` if `nullopt`
+ */
+template <typename T>
+constexpr FieldValue ToFieldValue(std::optional<T> optional) {
+    if (!optional.has_value()) {
+        return std::monostate{};
+    }
+    return FieldValue{std::in_place_type<T>, std::move(*optional)};
+}
+
+/**
+ * \brief Convert an optional int into an integer `FieldValue`.
+ * \param optional optional integer value
+ * \return the field value, or `std::monostate` if `nullopt`
+ */
+constexpr FieldValue ToFieldValue(std::optional<int> optional) {
+    return ToFieldValue(optional.transform([](auto value) { return static_cast<std::int64_t>(value); }));
+}
+
+/**
+ * \brief Format a string from a `FieldValue`. Enum values are formatted using their named representation.
+ * \param value field value
+ * \return string representation of the value, or empty string if the value is not set
+ */
+constexpr std::string FromFieldValue(const FieldValue& value) {
+    return std::visit(
+        [](const auto& inner) -> std::string {
+            using T = std::decay_t<decltype(inner)>;
+            if constexpr (std::is_same_v<T, std::monostate>) {
+                return "";
+            } else if constexpr (std::is_same_v<T, std::int64_t>) {
+                return std::to_string(inner);
+            } else if constexpr (std::is_same_v<T, double>) {
+                return FromDouble(inner);
+            } else if constexpr (std::is_same_v<T, InternedString>) {
+                return std::string{inner.View()};
+            } else if constexpr (std::is_same_v<T, std::string>) {
+                return inner;
+            } else if constexpr (std::is_same_v<T, IntervalType>) {
+                return FromInterval(inner);
+            } else if constexpr (std::is_same_v<T, TimestampType>) {
+                return FromTimestamp(inner);
+            } else if constexpr (std::is_same_v<T, DeviceType>) {
+                return FromDevice(inner);
+            } else {
+                return FromButtonAction(inner);
+            }
+        },
+        value
+    );
+}
 } // namespace evget
 
 #endif
@@ -9,6 +9,7 @@
 #include <boost/asio/awaitable.hpp>
 
 #include <functional>
+#include <span>
 #include <utility>
 
 #include "evget/error.h"
@@ -35,6 +36,7 @@ public:
     EventHandler(Store& storage, EventTransformer<T>& transformer, NextEvent<T>& next_event);
 
     boost::asio::awaitable<Result<void>> Notify(T event) override;
+    boost::asio::awaitable<Result<void>> NotifyBatch(std::span<T> events) override;
     boost::asio::awaitable<Result<void>> Start() override;
 
     /**
@@ -60,12 +62,20 @@ void EventHandler<T>::Stop() {
 
 template <typename T>
 EventHandler<T>::EventHandler(Store& storage, EventTransformer<T>& transformer, NextEvent<T>& next_event)
-    : storage_{storage}, transformer_{transformer}, event_loop_{next_event, {{*this}}} {}
+    : storage_{storage}, transformer_{transformer}, event_loop_{next_event, {{*this}}} {
+    // Build events in the memory of the store they are passed to.
+    transformer.SetDataSource([&storage] { return storage.NewData(); });
+}
 
 template <typename T>
 boost::asio::awaitable<Result<void>> EventHandler<T>::Notify(T event) {
     co_return storage_.get().StoreEvent(transformer_.get().TransformEvent(std::move(event)));
 }
+
+template <typename T>
+boost::asio::awaitable<Result<void>> EventHandler<T>::NotifyBatch(std::span<T> events) {
+    co_return storage_.get().StoreEvent(transformer_.get().TransformEvents(events));
+}
 } // namespace evget
 
 #endif
@@ -8,6 +8,9 @@
 
 #include <boost/asio/awaitable.hpp>
 
+#include <span>
+#include <utility>
+
 #include "evget/error.h"
 
 namespace evget {
@@ -25,6 +28,12 @@ public:
      */
     virtual boost::asio::awaitable<Result<void>> Notify(T event) = 0;
 
+    /**
+     * \brief Notify of a batch of events, in order. The default implementation calls `Notify` for each event.
+     * \param events events, which may be moved from
+     */
+    virtual boost::asio::awaitable<Result<void>> NotifyBatch(std::span<T> events);
+
     /**
      * \brief Start the listener processing.
      */
@@ -41,4 +50,16 @@ public:
 };
 } // namespace evget
 
+template <typename T>
+boost::asio::awaitable<evget::Result<void>> evget::EventListener<T>::NotifyBatch(std::span<T> events) {
+    for (auto& event : events) {
+        auto result = co_await Notify(std::move(event));
+        if (!result.has_value()) {
+            co_return result;
+        }
+    }
+
+    co_return Result<void>{};
+}
+
 #endif
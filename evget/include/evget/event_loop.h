@@ -6,6 +6,8 @@
 #ifndef EVGET_EVENT_LOOP_H
 #define EVGET_EVENT_LOOP_H
 
+#include <vector>
+
 #include "evget/event_listener.h"
 #include "evget/next_event.h"
 
@@ -25,7 +27,8 @@ public:
     EventLoop(NextEvent<T>& next_event, std::vector<std::reference_wrapper<EventListener<T>>> listeners);
 
     /**
-     * \brief Start processing events and notify listeners.
+     * \brief Start processing events and notify listeners. Events are fetched in batches of everything that is
+     *        available, and each batch is passed to a listener at once.
      */
     boost::asio::awaitable<Result<void>> Start();
 
@@ -57,14 +60,16 @@ evget::EventLoop<T>::EventLoop(
 
 template <typename T>
 boost::asio::awaitable<evget::Result<void>> evget::EventLoop<T>::Start() {
+    std::vector<T> events{};
     while (!co_await IsStopped()) {
         for (auto& listener : listeners_) {
-            auto event = co_await next_event_.get().Next();
-            if (!event.has_value()) {
-                co_return Err{event.error()};
+            events.clear();
+            auto next = co_await next_event_.get().NextBatch(events);
+            if (!next.has_value()) {
+                co_return Err{next.error()};
             }
 
-            auto result = co_await listener.get().Notify(std::move(*event));
+            auto result = co_await listener.get().NotifyBatch(events);
             if (!result.has_value()) {
                 co_return Err{result.error()};
             }
@@ -6,6 +6,10 @@
 #ifndef EVGET_EVENT_TRANSFORMER_H
 #define EVGET_EVENT_TRANSFORMER_H
 
+#include <functional>
+#include <span>
+#include <utility>
+
 #include "evget/event/data.h"
 
 namespace evget {
@@ -24,6 +28,21 @@ public:
      */
     virtual Data TransformEvent(T event) = 0;
 
+    /**
+     * \brief Transform a batch of events into a single data object, preserving their order. The default
+     *        implementation merges the result of `TransformEvent` for each event.
+     * \param events events to transform, which may be moved from
+     * \return transformed event data
+     */
+    virtual Data TransformEvents(std::span<T> events);
+
+    /**
+     * \brief Set how the data for transformed events is created, so that events can be built in the memory of the
+     *        store they are passed to. By default, data uses the default memory resource.
+     * \param new_data creates empty data for an event
+     */
+    void SetDataSource(std::function<Data()> new_data);
+
     EventTransformer() = default;
 
     virtual ~EventTransformer() = default;
@@ -33,7 +52,36 @@ public:
 
     EventTransformer(const EventTransformer&) = delete;
     EventTransformer& operator=(const EventTransformer&) = delete;
+
+protected:
+    /**
+     * \brief Create empty data for a transformed event from the data source.
+     * \return empty data
+     */
+    Data NewData();
+
+private:
+    std::function<Data()> new_data_{[] { return Data{}; }};
 };
 } // namespace evget
 
+template <typename T>
+evget::Data evget::EventTransformer<T>::TransformEvents(std::span<T> events) {
+    auto data = NewData();
+    for (auto& event : events) {
+        data.MergeWith(TransformEvent(std::move(event)));
+    }
+    return data;
+}
+
+template <typename T>
+void evget::EventTransformer<T>::SetDataSource(std::function<Data()> new_data) {
+    new_data_ = std::move(new_data);
+}
+
+template <typename T>
+evget::Data evget::EventTransformer<T>::NewData() {
+    return new_data_();
+}
+
 #endif
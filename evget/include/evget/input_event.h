@@ -35,6 +35,12 @@ public:
      */
     [[nodiscard]] T& ViewData();
 
+    /**
+     * \brief Get a const reference to the event data.
+     * \return reference to the event data
+     */
+    [[nodiscard]] const T& ViewData() const;
+
     /**
      * \brief Get the inner data of this class by moving out of the class.
      * \return the timestamp and inner event data
@@ -61,6 +67,11 @@ T& evget::InputEvent<T>::ViewData() {
     return event_;
 }
 
+template <typename T>
+const T& evget::InputEvent<T>::ViewData() const {
+    return event_;
+}
+
 template <typename T>
 std::pair<evget::TimestampType, T> evget::InputEvent<T>::IntoInner() && {
     return {std::move(timestamp_), std::move(event_)};
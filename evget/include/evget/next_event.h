@@ -8,6 +8,9 @@
 
 #include <boost/asio/awaitable.hpp>
 
+#include <utility>
+#include <vector>
+
 #include "evget/error.h"
 
 namespace evget {
@@ -25,6 +28,14 @@ public:
      */
     [[nodiscard]] virtual boost::asio::awaitable<Result<T>> Next() const = 0;
 
+    /**
+     * \brief Get all events that are available without waiting, waiting only until there is at least one. The
+     *        default implementation appends a single event from `Next`.
+     * \param events vector to append the events to, which can be reused between calls to avoid allocating
+     * \return a result indicating whether getting the events succeeded
+     */
+    [[nodiscard]] virtual boost::asio::awaitable<Result<void>> NextBatch(std::vector<T>& events) const;
+
     NextEvent() = default;
 
     virtual ~NextEvent() = default;
@@ -37,4 +48,15 @@ public:
 
 } // namespace evget
 
+template <typename T>
+boost::asio::awaitable<evget::Result<void>> evget::NextEvent<T>::NextBatch(std::vector<T>& events) const {
+    auto event = co_await Next();
+    if (!event.has_value()) {
+        co_return Err{event.error()};
+    }
+
+    events.push_back(std::move(*event));
+    co_return Result<void>{};
+}
+
 #endif // EVGET_NEXT_EVENT_H
@@ -0,0 +1,61 @@
+/**
+ * \file buffer_limits.h
+ * \brief Limits on buffered events and what to do when they are reached.
+ */
+
+#ifndef EVGET_STORAGE_BUFFER_LIMITS_H
+#define EVGET_STORAGE_BUFFER_LIMITS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace evget {
+
+/**
+ * \brief What to do with new events when the buffer is full because the stores cannot keep up.
+ *
+ * A blocked capture thread sleeps until a store finishes writing a batch or a drain frees buffer space, rather than
+ * spinning. If the scheduler stops while capture is blocked, the new events are not stored and an error is returned.
+ */
+enum class OverflowPolicy : std::uint8_t {
+    kBlock, ///< apply back-pressure by parking capture until the stores release memory, never losing events
+    kDropOldest, ///< drop the oldest buffered events
+    kDropMouseMoves, ///< drop all buffered mouse moves, then the oldest events
+    kCoalesceMoves, ///< keep only the last of consecutive buffered mouse moves, then park capture like `kBlock`
+};
+
+/**
+ * \brief Limits on the events held in memory, counting both buffered events and batches that the stores have not
+ *        finished writing. A value of zero disables a limit.
+ */
+struct BufferLimits {
+    std::size_t max_events{0}; ///< maximum number of entries held in memory
+    std::size_t max_bytes{0}; ///< approximate maximum number of bytes held in memory
+    OverflowPolicy policy{OverflowPolicy::kBlock}; ///< what to do when a limit is reached
+
+    /**
+     * \brief Split the limits evenly between buffers, so that together they stay within the limits. A disabled limit
+     *        stays disabled and an enabled limit is never split below one.
+     * \param n_buffers the number of buffers sharing the limits
+     * \return the limits for each buffer
+     */
+    [[nodiscard]] constexpr BufferLimits Split(std::size_t n_buffers) const {
+        auto split = [n_buffers](std::size_t limit) {
+            return limit == 0 || n_buffers <= 1 ? limit : std::max(limit / n_buffers, std::size_t{1});
+        };
+        return {.max_events = split(max_events), .max_bytes = split(max_bytes), .policy = policy};
+    }
+};
+
+/**
+ * \brief Counts of entries lost to the overflow policy.
+ */
+struct OverflowCounters {
+    std::uint64_t dropped{0}; ///< entries that were dropped
+    std::uint64_t coalesced{0}; ///< mouse moves that were merged into a later mouse move
+};
+
+} // namespace evget
+
+#endif
@@ -8,39 +8,100 @@
 
 #include <boost/asio/awaitable.hpp>
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
 #include <optional>
 #include <vector>
 
-#include "evget/async/container/locking_vector.h"
+#include "evget/async/container/spsc_ring.h"
 #include "evget/async/scheduler/scheduler.h"
 #include "evget/error.h"
 #include "evget/event/data.h"
+#include "evget/storage/buffer_limits.h"
 #include "evget/storage/store.h"
 
 namespace evget {
 
+/**
+ * \brief How the timer which stores events below the threshold chooses its period.
+ */
+enum class FlushTimer : std::uint8_t {
+    kFixed, ///< wake up once per `store_after` period
+    kAdaptive, ///< treat `store_after` as the target latency and shorten the period by the time the stores take
+};
+
+/**
+ * \brief Buffers events and stores them in batches once enough entries or bytes have arrived or a timer expires.
+ *        Events are handed off through a lock-free ring buffer, so `StoreEvent` must be called from a single producer
+ *        at a time. Each batch is shared by all stores without copying and the stores are written concurrently. Every
+ *        store has its own ordered queue, so a store receives batches in flush order and never has two writes in
+ *        progress.
+ *
+ * Errors are handled per store. A store which fails to write is logged and not written to again, while the other
+ * stores keep receiving batches. The scheduler is stopped once every store has failed.
+ *
+ * The memory used by buffered events and unwritten batches can be capped with `BufferLimits`. When a limit is
+ * reached, the overflow policy decides whether capture blocks or buffered events are dropped or coalesced, and lost
+ * entries are counted in `Overflow`. Batches already handed to the stores are never dropped, so if they alone fill the
+ * buffer under a dropping policy, the new events are dropped instead.
+ *
+ * When a threshold is reached, the buffer is drained and merged into a batch on the scheduler, so capture does not wait
+ * for it. A manager with a threshold of one event, which streams every event, drains on the capture thread instead if
+ * no consumer is already doing so, because the window is usually that one event. A store that is still writing picks
+ * up new batches without another spawn.
+ *
+ * Events are built in an arena for the current flush window, created by `NewData` on the capture thread. A drain
+ * starts a new window, so the next event gets a fresh arena, and the previous arena is released in one operation once
+ * the last store has written every batch that holds its events.
+ *
+ * The timer only runs while events are buffered, so an idle manager does not wake up. It starts again one period after
+ * the next event arrives.
+ */
 class DatabaseManager : public Store {
 public:
     /**
      * \brief Construct a database manager.
      * \param scheduler scheduler to use
      * \param store_in stores to store events in
-     * \param n_events the number of events to hold before inserting
+     * \param n_events the number of entries to hold before inserting
+     * \param n_bytes the approximate number of bytes to hold before inserting, or zero to only use `n_events`
      * \param store_after store events after this time event if `n_events` is not reached
+     * \param limits limits on the events held in memory, which should be larger than `n_events`
+     * \param timer how the timer chooses its period
      */
     DatabaseManager(
         std::shared_ptr<Scheduler> scheduler,
         std::vector<std::shared_ptr<Store>> store_in,
         std::size_t n_events,
-        std::chrono::seconds store_after
+        std::size_t n_bytes,
+        std::chrono::milliseconds store_after,
+        BufferLimits limits = {},
+        FlushTimer timer = FlushTimer::kFixed
     );
 
     Result<void> StoreEvent(Data event) override;
 
+    /**
+     * \brief Create data in the arena for the current flush window, starting a new arena if the buffer was drained
+     *        since the last call. Like `StoreEvent`, this must be called from the single producer. A threshold of one
+     *        event uses the default memory resource, since each window is a single event.
+     * \return empty data
+     */
+    Data NewData() override;
+
+    /**
+     * \brief Get the number of entries lost to the overflow policy so far.
+     * \return the overflow counters
+     */
+    [[nodiscard]] OverflowCounters Overflow() const;
+
     /**
      * \brief Add a store to the database manager.
      * \param store unique pointer to the store to add
@@ -48,33 +109,164 @@ public:
     void AddStore(std::unique_ptr<Store> store) const;
 
 private:
+    /**
+     * \brief A count of entries and their approximate bytes. Consumers call `Notify` after freeing memory or buffer
+     *        space, which advances the generation and wakes a blocked producer waiting in `WaitForRelease`. The
+     *        generation can be read without the lock, which is only taken to notify and wait.
+     */
+    struct Usage {
+        std::atomic<std::size_t> entries{0};
+        std::atomic<std::size_t> bytes{0};
+        std::mutex lock;
+        std::condition_variable released;
+        std::atomic<std::uint64_t> generation{0};
+
+        void Acquire(std::size_t n_entries, std::size_t n_bytes);
+        void Release(std::size_t n_entries, std::size_t n_bytes);
+        void Notify();
+        void WaitForRelease(std::uint64_t generation, std::chrono::milliseconds timeout);
+    };
+
+    /**
+     * \brief A share of the usage which is released when the reservation is destroyed, notifying a blocked producer.
+     */
+    class Reservation {
+    public:
+        Reservation(std::shared_ptr<Usage> usage, std::size_t n_entries, std::size_t n_bytes);
+        ~Reservation();
+
+        Reservation(const Reservation&) = delete;
+        Reservation(Reservation&& other) noexcept = default;
+        Reservation& operator=(const Reservation&) = delete;
+        Reservation& operator=(Reservation&&) noexcept = delete;
+
+    private:
+        std::shared_ptr<Usage> usage_;
+        std::size_t n_entries_;
+        std::size_t n_bytes_;
+    };
+
+    /**
+     * \brief The events drained in one flush window, moved out of the buffer without copying. The data values stay in
+     *        the arenas they were captured in, which the data keeps alive until the batch is released after the last
+     *        store finishes. A batch is published to all stores as a single immutable shared object.
+     */
+    struct Batch {
+        Data data;
+        Reservation reservation;
+        std::chrono::steady_clock::time_point drained_at;
+    };
+
+    /**
+     * \brief The batches waiting to be written to one store. A single worker writes the queue at a time, in order.
+     *        Batches that arrive while the worker is writing are written together as one group, which a
+     *        transactional store commits at once. The queue holds at most `kMaxPendingBatches` batches, after which
+     *        the buffer is not drained and events stay in the ring until the queue has space again. The worker
+     *        keeps a moving average of the time from draining a batch to finishing its write. A queue whose store
+     *        failed is marked as failed and no longer receives batches.
+     */
+    struct StoreQueue {
+        explicit StoreQueue(std::shared_ptr<Store> store);
+
+        std::shared_ptr<Store> store;
+        std::mutex lock;
+        std::deque<std::shared_ptr<const Batch>> pending;
+        bool writing{false};
+        bool failed{false};
+        std::atomic<std::chrono::microseconds::rep> write_latency{0};
+    };
+
     struct StoresHolder {
         std::mutex lock;
-        std::vector<std::shared_ptr<Store>> stores;
+        std::vector<std::shared_ptr<StoreQueue>> stores;
+    };
+
+    /**
+     * \brief Events waiting to be stored. The capture thread is the only producer and never locks. Consumers
+     *        serialize on `drain_lock`, which the capture thread only ever tries to lock when the ring is full or a
+     *        limit is reached. While holding it, the capture thread may also pop and push back events to apply the
+     *        overflow policy.
+     *
+     * `buffered` counts the events in the ring, which decide when to flush. `usage` counts everything held in
+     * memory, which is checked against the limits, and is shared with the batches so that they can give back their
+     * share when released. `timer_parked` is set while the timer is stopped because nothing was buffered, and the
+     * capture thread restarts the timer when it clears the flag. `window` advances whenever events leave the ring, by a
+     * drain or the overflow policy, which tells the capture thread to start a new arena.
+     */
+    struct Buffer {
+        Buffer(std::size_t capacity, BufferLimits limits);
+
+        void Acquire(std::size_t n_entries, std::size_t n_bytes);
+        void Release(std::size_t n_entries, std::size_t n_bytes);
+
+        SpscRing<Data> ring;
+        std::mutex drain_lock;
+        std::atomic<bool> drain_pending{false};
+        std::atomic<bool> timer_parked{true};
+        BufferLimits limits;
+        Usage buffered;
+        std::shared_ptr<Usage> usage{std::make_shared<Usage>()};
+        std::atomic<std::uint64_t> dropped{0};
+        std::atomic<std::uint64_t> coalesced{0};
+        std::atomic<std::uint64_t> window{0};
     };
 
-    static std::vector<std::shared_ptr<Store>> Snapshot(StoresHolder& holder);
+    static constexpr std::size_t kMinBufferCapacity{1024};
+    static constexpr std::size_t kMaxPendingBatches{8};
+    static constexpr std::chrono::milliseconds kMinStoreAfter{10};
+    static constexpr std::chrono::milliseconds kBlockedWait{10};
+    static constexpr std::size_t kMaxArenaBlock{1024 * 1024};
+
+    static std::vector<std::shared_ptr<StoreQueue>> Snapshot(StoresHolder& holder);
+    static void Flush(Buffer& buffer, StoresHolder& store_in, Scheduler& scheduler);
+    static void FlushLocked(Buffer& buffer, StoresHolder& store_in, Scheduler& scheduler);
+    static bool HasCapacity(const std::vector<std::shared_ptr<StoreQueue>>& store_in);
+    static std::optional<Batch> DrainLocked(Buffer& buffer);
+    static bool Fits(const Buffer& buffer, std::size_t n_entries, std::size_t n_bytes);
+    static bool MakeRoom(Buffer& buffer);
+    static bool DropOldest(Buffer& buffer);
+    static bool RemoveMouseMoves(Buffer& buffer, bool coalesce);
+    static bool ParkTimer(Buffer& buffer);
+    static std::chrono::milliseconds AdaptivePeriod(
+        std::chrono::milliseconds target,
+        const std::vector<std::shared_ptr<StoreQueue>>& store_in
+    );
     static void SpawnStoreData(
-        std::optional<std::vector<Data>> inner,
-        std::vector<std::shared_ptr<Store>> store_in,
+        std::optional<Batch> batch,
+        const std::vector<std::shared_ptr<StoreQueue>>& store_in,
+        Scheduler& scheduler
+    );
+    static boost::asio::awaitable<Result<void>> StoreCoroutine(std::shared_ptr<StoreQueue> queue);
+    static boost::asio::awaitable<Result<void>> StoreThresholdCoroutine(
+        std::shared_ptr<Buffer> data,
+        std::shared_ptr<StoresHolder> store_in,
         Scheduler& scheduler
     );
-    static boost::asio::awaitable<Result<void>> StoreCoroutine(Data data, std::vector<std::shared_ptr<Store>> store_in);
     static boost::asio::awaitable<Result<void>> StoreAfterCoroutine(
         std::weak_ptr<Scheduler> scheduler,
-        std::shared_ptr<LockingVector<Data>> data,
+        std::shared_ptr<Buffer> data,
         std::shared_ptr<StoresHolder> store_in,
-        std::chrono::seconds store_after
+        std::chrono::milliseconds store_after,
+        FlushTimer timer
     );
     static void ResultHandler(Result<void> result, Scheduler& scheduler);
+    static void StoreResultHandler(
+        Result<void> result,
+        const std::vector<std::shared_ptr<StoreQueue>>& store_in,
+        Scheduler& scheduler
+    );
 
     void SpawnStoreAfter() const;
 
     std::shared_ptr<Scheduler> scheduler_;
     std::shared_ptr<StoresHolder> store_in_;
     size_t n_events_{};
-    std::chrono::seconds store_after_{};
-    std::shared_ptr<LockingVector<Data>> data_ = std::make_shared<LockingVector<Data>>();
+    size_t n_bytes_{};
+    std::chrono::milliseconds store_after_{};
+    FlushTimer timer_{FlushTimer::kFixed};
+    std::shared_ptr<Buffer> data_;
+    std::shared_ptr<std::pmr::memory_resource> arena_;
+    std::uint64_t arena_window_{0};
 };
 
 } // namespace evget
@@ -6,11 +6,13 @@
 #ifndef EVGET_STORAGE_DATABASE_STORAGE_H
 #define EVGET_STORAGE_DATABASE_STORAGE_H
 
+#include <cstddef>
 #include <filesystem>
+#include <functional>
+#include <map>
 #include <memory>
-#include <optional>
-#include <string>
-#include <vector>
+#include <span>
+#include <string_view>
 
 #include "evget/database/connection.h"
 #include "evget/database/query.h"
@@ -33,33 +35,93 @@ public:
      */
     DatabaseStorage(std::unique_ptr<Connection> connection, std::filesystem::path database);
 
+    /**
+     * \brief Store events using the open connection and cached prepared statements. Entries of the same type are
+     *        written using multi-row inserts, chunked to the connection's parameter limit. If the connection is not
+     *        open, it is opened first. On error, the transaction is rolled back and the connection is reopened on
+     *        the next call.
+     * \param events events to store
+     * \return a result indicating success or failure
+     */
     Result<void> StoreEvent(Data events) override;
 
     /**
-     * \brief Initialize the database with tables.
+     * \brief Store a shared batch in the same way as `StoreEvent`, without copying it.
+     * \param batch events to store
+     * \return a result indicating success or failure
+     */
+    Result<void> StoreBatch(const Data& batch) override;
+
+    /**
+     * \brief Store several shared batches in order within a single transaction, so that a group of batches is
+     *        committed at once.
+     * \param batches the batches to store, oldest first
+     * \return a result indicating success or failure
+     */
+    Result<void> StoreBatches(std::span<const std::reference_wrapper<const Data>> batches) override;
+
+    /**
+     * \brief Open the database connection and initialize the database with tables. The connection stays open for
+     *        subsequent calls to `StoreEvent`.
      * \return a result indicating success of failure
      */
-    [[nodiscard]] Result<void> Init() const;
+    [[nodiscard]] Result<void> Init();
 
 private:
+    /**
+     * \brief Prepared multi-row insert statements for one table, keyed by the number of rows they insert. Row counts
+     *        are powers of two so that only a small number of statements is prepared per table.
+     */
+    struct TableStatements {
+        std::map<std::size_t, std::unique_ptr<Query>> insert;
+    };
+
+    /**
+     * \brief Prepared insert statements which are reused across calls to `StoreEvent`.
+     */
+    struct Statements {
+        TableStatements key;
+        TableStatements mouse_move;
+        TableStatements mouse_click;
+        TableStatements mouse_scroll;
+    };
+
+    /**
+     * \brief The table and field names used to build inserts of entries into a table. Each row also has a modifiers
+     *        column after its fields.
+     */
+    struct TableQueries {
+        std::string_view table;
+        std::span<const std::string_view> fields;
+    };
+
     std::unique_ptr<Connection> connection_;
     std::filesystem::path database_;
+    Statements statements_;
+    bool connected_{false};
+
+    Result<void> Connect();
+    void Disconnect();
+    Result<void> InsertEntries(std::span<const std::reference_wrapper<const Data>> events);
 
     Result<void> InsertEvents(
-        const Entry& entry,
-        std::optional<std::unique_ptr<Query>>& insert_statement,
-        std::optional<std::unique_ptr<Query>>& insert_modifier_statement,
-        std::string insert_query,
-        std::string insert_modifier_query
-    ) const;
-    void SetOptionalStatement(std::optional<std::unique_ptr<Query>>& query, std::string query_string) const;
-    static Result<void>
-    BindValues(std::unique_ptr<Query>& query, const std::vector<std::string>& data, const std::string& entry_uuid);
-    static Result<void> BindValuesModifier(
-        std::unique_ptr<Query>& query,
-        const std::vector<std::string>& modifiers,
-        const std::string& entry_uuid
+        std::span<const std::reference_wrapper<const Entry>> entries,
+        TableStatements& statements,
+        const TableQueries& queries,
+        std::size_t max_parameters
     );
+    Result<void> InsertChunk(
+        std::span<const std::reference_wrapper<const Entry>> entries,
+        TableStatements& statements,
+        const TableQueries& queries
+    );
+    Query& GetStatement(
+        std::map<std::size_t, std::unique_ptr<Query>>& statements,
+        const TableQueries& queries,
+        std::size_t n_rows
+    ) const;
+    static Result<void> ExecuteStatement(Query& query);
+    static void BindValue(Query& query, int position, const FieldValue& value);
 };
 } // namespace evget
 
@@ -0,0 +1,50 @@
+/**
+ * \file fan_out_store.h
+ * \brief Store that forwards events to several stores.
+ */
+
+#ifndef EVGET_STORAGE_FAN_OUT_STORE_H
+#define EVGET_STORAGE_FAN_OUT_STORE_H
+
+#include <functional>
+#include <vector>
+
+#include "evget/error.h"
+#include "evget/event/data.h"
+#include "evget/storage/store.h"
+
+namespace evget {
+
+/**
+ * \brief A `Store` that forwards each event to all of its inner stores, such as a `DatabaseManager` which batches
+ *        events and another which streams them.
+ */
+class FanOutStore : public Store {
+public:
+    /**
+     * \brief Construct a fan out store.
+     * \param inner references to the inner stores to forward to, which must outlive this store
+     */
+    explicit FanOutStore(std::vector<std::reference_wrapper<Store>> inner);
+
+    /**
+     * \brief Forward the event to every inner store, copying it for all but the last. Every inner store receives
+     *        the event even if an earlier one fails.
+     * \param event the event to forward
+     * \return the first error from the inner stores, if any
+     */
+    Result<void> StoreEvent(Data event) override;
+
+    /**
+     * \brief Create data from the last inner store, which is the only one that receives the event without a copy.
+     * \return empty data
+     */
+    Data NewData() override;
+
+private:
+    std::vector<std::reference_wrapper<Store>> inner_;
+};
+
+} // namespace evget
+
+#endif
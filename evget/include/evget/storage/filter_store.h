@@ -30,6 +30,7 @@ public:
     FilterStore(Store& inner, std::optional<std::set<DeviceType>> allowed);
 
     Result<void> StoreEvent(Data event) override;
+    Data NewData() override;
 
 private:
     Store* inner_;
@@ -0,0 +1,48 @@
+/**
+ * \file json_lines_storage.h
+ * \brief JSON Lines storage implementation for outputting one compact JSON object per event.
+ */
+
+#ifndef EVGET_STORAGE_JSON_LINES_STORAGE_H
+#define EVGET_STORAGE_JSON_LINES_STORAGE_H
+
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <variant>
+
+#include "evget/error.h"
+#include "evget/event/data.h"
+#include "evget/storage/store.h"
+
+namespace evget {
+
+/**
+ * \brief A storage class which writes events in the JSON Lines (NDJSON) format, where each entry is a compact
+ *        JSON object on its own line. The output can be appended to, split by line and read while it is written.
+ */
+class JsonLinesStorage : public Store {
+public:
+    /**
+     * \brief Construct a `JsonLinesStorage` with a standard output stream.
+     * \param ostream unique pointer to the output stream
+     */
+    explicit JsonLinesStorage(std::unique_ptr<std::ostream> ostream);
+
+    /**
+     * \brief Construct a `JsonLinesStorage` with a custom deleter output stream.
+     * \param ostream unique pointer to the output stream with custom deleter
+     */
+    explicit JsonLinesStorage(std::unique_ptr<std::ostream, std::function<void(std::ostream*)>> ostream);
+
+    Result<void> StoreEvent(Data event) override;
+    Result<void> StoreBatch(const Data& batch) override;
+    Result<void> Flush() override;
+
+private:
+    std::variant<std::unique_ptr<std::ostream>, std::unique_ptr<std::ostream, std::function<void(std::ostream*)>>>
+        ostream_;
+};
+} // namespace evget
+
+#endif
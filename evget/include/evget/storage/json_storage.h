@@ -6,6 +6,7 @@
 #ifndef EVGET_STORAGE_JSON_STORAGE_H
 #define EVGET_STORAGE_JSON_STORAGE_H
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <ostream>
@@ -18,27 +19,41 @@
 namespace evget {
 
 /**
- * \brief A storage class which prints events to stdout.
+ * \brief A storage class which writes events as JSON to an output stream. Entries are serialized directly to the
+ *        stream, with one object per batch. With an indent of zero, each batch is written compactly on its own line.
  */
 class JsonStorage : public Store {
 public:
+    /**
+     * \brief The default number of spaces to indent by.
+     */
+    static constexpr std::size_t kIndent{4};
+
     /**
      * \brief Construct a `JsonStorage` with a standard output stream.
      * \param ostream unique pointer to the output stream
+     * \param indent number of spaces to indent by, or zero for compact output
      */
-    explicit JsonStorage(std::unique_ptr<std::ostream> ostream);
+    explicit JsonStorage(std::unique_ptr<std::ostream> ostream, std::size_t indent = kIndent);
 
     /**
      * \brief Construct a `JsonStorage` with a custom deleter output stream.
      * \param ostream unique pointer to the output stream with custom deleter
+     * \param indent number of spaces to indent by, or zero for compact output
      */
-    explicit JsonStorage(std::unique_ptr<std::ostream, std::function<void(std::ostream*)>> ostream);
+    explicit JsonStorage(
+        std::unique_ptr<std::ostream, std::function<void(std::ostream*)>> ostream,
+        std::size_t indent = kIndent
+    );
 
     Result<void> StoreEvent(Data event) override;
+    Result<void> StoreBatch(const Data& batch) override;
+    Result<void> Flush() override;
 
 private:
     std::variant<std::unique_ptr<std::ostream>, std::unique_ptr<std::ostream, std::function<void(std::ostream*)>>>
         ostream_;
+    std::size_t indent_;
 };
 } // namespace evget
 
@@ -0,0 +1,64 @@
+/**
+ * \file json_writer.h
+ * \brief Streaming JSON serializer for event entries.
+ */
+
+#ifndef EVGET_STORAGE_JSON_WRITER_H
+#define EVGET_STORAGE_JSON_WRITER_H
+
+#include <cstddef>
+#include <ostream>
+#include <string_view>
+
+#include "evget/event/data.h"
+#include "evget/event/entry.h"
+
+namespace evget {
+
+/**
+ * \brief Writes entries as JSON directly to an output stream, without building an intermediate document.
+ *        An entry is written as an object with a `type`, a `fields` array of `name` and `data` objects and
+ *        a `modifiers` array.
+ */
+class JsonWriter {
+public:
+    /**
+     * \brief Create a writer for an output stream.
+     * \param ostream the stream to write to, which must outlive the writer
+     * \param indent number of spaces to indent nested values by, where zero writes compact JSON on a single line
+     */
+    JsonWriter(std::ostream& ostream, std::size_t indent);
+
+    /**
+     * \brief Write all entries as a single `{"entries": [...]}` object followed by a newline.
+     * \param data the entries to write
+     */
+    void WriteEntries(const Data& data);
+
+    /**
+     * \brief Write a single entry object, without a trailing newline.
+     * \param entry the entry to write
+     */
+    void WriteEntry(const Entry& entry);
+
+    /**
+     * \brief Write a string as a quoted and escaped JSON string.
+     * \param value the string to write
+     */
+    void WriteString(std::string_view value);
+
+private:
+    std::ostream& ostream_;
+    std::size_t indent_;
+    std::size_t depth_{0};
+
+    void WriteValue(const FieldValue& value);
+    void WriteKey(std::string_view key);
+    void BeginScope(char open);
+    void EndScope(char close, bool empty);
+    void Separator();
+    void Newline();
+};
+} // namespace evget
+
+#endif
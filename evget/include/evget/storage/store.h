@@ -6,6 +6,9 @@
 #ifndef EVGET_STORAGE_STORE_H
 #define EVGET_STORAGE_STORE_H
 
+#include <functional>
+#include <span>
+
 #include "evget/error.h"
 #include "evget/event/data.h"
 
@@ -21,6 +24,54 @@ public:
      */
     virtual Result<void> StoreEvent(Data event) = 0;
 
+    /**
+     * \brief Create empty data for the next event, which is later passed to `StoreEvent`. A store can override this
+     *        to build events in memory it manages, such as an arena. By default, data uses the default memory
+     *        resource.
+     * \return empty data
+     */
+    virtual Data NewData() {
+        return Data{};
+    }
+
+    /**
+     * \brief Store a batch of event data without taking ownership of it. The same batch may be read by other stores
+     *        at the same time and may be released after this returns, so a store that keeps entries must copy them.
+     *        By default, the batch is copied into `StoreEvent`.
+     * \param batch the batch to store
+     * \return a result indicating success or failure
+     */
+    virtual Result<void> StoreBatch(const Data& batch) {
+        return StoreEvent(batch);
+    }
+
+    /**
+     * \brief Store several batches of event data in order, under the same borrowing rules as `StoreBatch`. A store
+     *        that supports transactions can override this to commit the whole group at once. By default, each batch
+     *        is passed to `StoreBatch`, stopping at the first error.
+     * \param batches the batches to store, oldest first
+     * \return a result indicating success or failure
+     */
+    virtual Result<void> StoreBatches(std::span<const std::reference_wrapper<const Data>> batches) {
+        for (const auto& batch : batches) {
+            auto result = StoreBatch(batch);
+            if (!result.has_value()) {
+                return result;
+            }
+        }
+        return {};
+    }
+
+    /**
+     * \brief Flush anything the store has buffered to its output, called after each group of batches is written. A
+     *        store that writes through a buffered stream can override this, so that written events become visible to
+     *        readers once per group rather than once per entry. By default, this does nothing.
+     * \return a result indicating success or failure
+     */
+    virtual Result<void> Flush() {
+        return {};
+    }
+
     Store() = default;
 
     virtual ~Store() = default;
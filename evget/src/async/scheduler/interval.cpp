@@ -11,7 +11,7 @@
 
 #include "evget/error.h"
 
-evget::Interval::Interval(std::chrono::seconds period) : period_{period} {}
+evget::Interval::Interval(std::chrono::milliseconds period) : period_{period} {}
 
 boost::asio::awaitable<evget::Result<void>> evget::Interval::Tick() {
     // NOLINTBEGIN(clang-analyzer-core.CallAndMessage, clang-analyzer-core.NullDereference)
@@ -41,6 +41,11 @@ void evget::Interval::Reset() {
     }
 }
 
-std::chrono::seconds evget::Interval::Period() const {
+void evget::Interval::SetPeriod(std::chrono::milliseconds period) {
+    period_ = period;
+    Reset();
+}
+
+std::chrono::milliseconds evget::Interval::Period() const {
     return period_;
 }
@@ -24,9 +24,12 @@
 #include <vector>
 
 #include "evget/database/sqlite/connection.h"
+#include "evget/database/sqlite/tuning.h"
 #include "evget/error.h"
 #include "evget/event/device_type.h"
+#include "evget/storage/buffer_limits.h"
 #include "evget/storage/database_storage.h"
+#include "evget/storage/json_lines_storage.h"
 #include "evget/storage/json_storage.h"
 #include "evget/storage/store.h"
 
@@ -60,18 +63,55 @@ std::expected<bool, int> evget::Cli::Parse(int argc, char** argv) {
     app.add_option(
            "-n,--store-n-events",
            store_n_events_,
-           "Controls how many events to receive before outputting them to the store."
+           "Controls how many events to receive before outputting them to the store. "
+           "Device events that produce several events, such as tablet tip events, count each one."
     )
         ->default_val(kDefaultNEvents)
         ->check(CLI::PositiveNumber);
     app.add_option(
+           "--store-n-bytes",
+           store_n_bytes_,
+           "Also output events to the store once they use approximately this much memory, e.g. '4MiB'. "
+           "0 disables this threshold."
+    )
+        ->transform(CLI::AsSizeValue(false))
+        ->default_val(0);
+    auto* store_after = app.add_option(
+        "--store-after",
+        store_after_ms_,
+        "Store events at least every interval specified with this option, even if fewer events than "
+        "`--store-n-events` has been receieved. Accepts 'ms', 's' or 'min' units and defaults to milliseconds, "
+        "e.g. '100ms' or '2s'."
+    );
+    store_after
+        ->transform(CLI::AsNumberWithUnit(
+            std::map<std::string, std::size_t>{{"ms", 1}, {"s", kMillisPerSecond}, {"min", kMillisPerMinute}},
+            CLI::AsNumberWithUnit::CASE_INSENSITIVE
+        ))
+        ->check(CLI::PositiveNumber)
+        ->default_str(std::format("{}", std::chrono::duration_cast<std::chrono::seconds>(kDefaultStoreAfter)));
+    app.add_option_function<std::size_t>(
            "-s,--store-after-seconds",
-           store_after_,
-           "Store events at least every interval specified with this option, even if fewer events than "
-           "`--store-n-events` has been receieved."
+           [this](std::size_t seconds) { store_after_ms_ = seconds * kMillisPerSecond; },
+           "Same as `--store-after` with a whole number of seconds."
     )
-        ->default_val(kDefaultStoreAfter)
-        ->check(CLI::PositiveNumber);
+        ->check(CLI::PositiveNumber)
+        ->excludes(store_after);
+    app.add_flag(
+        "--store-adaptive",
+        store_adaptive_,
+        "Treat `--store-after` as a target latency. The interval is shortened by the time the outputs take to "
+        "write, and the timer sleeps while no events are buffered."
+    );
+    app.add_option("--stream", stream_)
+        ->transform(CLI::Transformer{StreamModeMappings(), CLI::ignore_case})
+        ->option_text(FormatEnum(
+            "MODE",
+            "Which outputs write events as soon as they arrive, in compact form, instead of waiting for "
+            "`--store-n-events` or `--store-after`.",
+            stream_mode_descriptions_,
+            ToString(stream_)
+        ));
     app.add_option("-e,--event-source", event_source_)
         ->transform(CLI::Transformer{EventSourceMappings(), CLI::ignore_case})
         ->option_text(
@@ -121,13 +161,47 @@ std::expected<bool, int> evget::Cli::Parse(int argc, char** argv) {
             "$SPDLOG_LEVEL or info"
         ));
 
+    app.add_option("-p,--sqlite-profile", sqlite_profile_)
+        ->transform(CLI::Transformer{SQLiteProfileMappings(), CLI::ignore_case})
+        ->option_text(FormatEnum(
+            "PROFILE",
+            "SQLite settings applied to database outputs.",
+            sqlite_profile_descriptions_,
+            ToString(sqlite_profile_)
+        ));
+
+    app.add_option(
+           "--buffer-events",
+           buffer_events_,
+           "The maximum number of events held in memory, including events the stores have not finished writing. "
+           "Should be larger than `--store-n-events`. 0 disables the limit."
+    )
+        ->default_val(0);
+    app.add_option(
+           "--buffer-bytes",
+           buffer_bytes_,
+           "The approximate maximum memory used by events held in memory, e.g. '256MiB'. 0 disables the limit."
+    )
+        ->transform(CLI::AsSizeValue(false))
+        ->default_val(0);
+    app.add_option("--overflow-policy", overflow_policy_)
+        ->transform(CLI::Transformer{OverflowPolicyMappings(), CLI::ignore_case})
+        ->option_text(FormatEnum(
+            "POLICY",
+            "What to do when the buffer limits are reached because the outputs cannot keep up.",
+            overflow_policy_descriptions_,
+            ToString(overflow_policy_)
+        ));
+
     app.add_option(
            "-o,--output",
            output_,
            "The output location of the storage. "
            "The file extension determines the storage format. "
-           "Either JSON files or sqlite databases are supported using .json or .sqlite endings. "
-           "'-' is supported to output to stdout when using json storage, which disables any logging."
+           "JSON files, JSON Lines files or sqlite databases are supported using .json, .jsonl or .ndjson, "
+           "or .sqlite endings. "
+           "'-' is supported to output to stdout when using json storage, which disables any logging. "
+           "stdout is streamed by default, see `--stream`."
     )
         ->default_val("-");
 
@@ -172,40 +246,65 @@ evget::StorageType evget::Cli::GetStorageType(const std::string& output) {
     if (ext == ".sqlite" || ext == ".sqlite3" || ext == ".db" || ext == ".db3" || ext == ".s3db" || ext == ".sl3") {
         return StorageType::kSqLite;
     }
+    if (ext == ".jsonl" || ext == ".ndjson") {
+        return StorageType::kJsonLines;
+    }
 
     return StorageType::kJson;
 }
 
-evget::Result<std::vector<std::unique_ptr<evget::Store>>> evget::Cli::ToStores() {
-    auto stores = std::vector<std::unique_ptr<Store>>{};
-    stores.reserve(output_.size());
+bool evget::Cli::IsStreamed(const std::string& output) const {
+    switch (stream_) {
+        case StreamMode::kAuto:
+            return output == "-";
+        case StreamMode::kAll:
+            return true;
+        case StreamMode::kNone:
+            return false;
+    }
+    return false;
+}
+
+evget::Result<evget::OutputStores> evget::Cli::ToStores() {
+    auto stores = OutputStores{};
 
     for (auto& output : this->output_) {
+        auto streamed = IsStreamed(output);
+        auto& into = streamed ? stores.streamed : stores.buffered;
+
         switch (GetStorageType(output)) {
             case StorageType::kSqLite: {
-                auto connect = std::make_unique<SQLiteConnection>();
+                auto connect = std::make_unique<SQLiteConnection>(SQLiteTuning::FromProfile(sqlite_profile_));
                 auto database = std::make_unique<DatabaseStorage>(std::move(connect), output);
                 auto result = database->Init();
                 if (!result.has_value()) {
                     return Err{result.error()};
                 }
 
-                stores.emplace_back(std::move(database));
+                into.emplace_back(std::move(database));
 
                 break;
             }
             case StorageType::kJson: {
+                // Streamed JSON is compact so that each write is a single line which can be read as it arrives.
+                std::size_t indent = streamed ? 0 : JsonStorage::kIndent;
                 if (output == "-") {
                     // Do nothing to delete std::cout.
                     auto deleter = [](std::ostream*) {};
                     std::unique_ptr<std::ostream, std::function<void(std::ostream*)>> out = {&std::cout, deleter};
 
-                    stores.emplace_back(std::make_unique<JsonStorage>(std::move(out)));
+                    into.emplace_back(std::make_unique<JsonStorage>(std::move(out), indent));
                 } else {
                     auto out = std::make_unique<std::ofstream>(output, std::ios_base::app);
-                    stores.emplace_back(std::make_unique<JsonStorage>(std::move(out)));
+                    into.emplace_back(std::make_unique<JsonStorage>(std::move(out), indent));
                 }
 
+                break;
+            }
+            case StorageType::kJsonLines: {
+                auto out = std::make_unique<std::ofstream>(output, std::ios_base::app);
+                into.emplace_back(std::make_unique<JsonLinesStorage>(std::move(out)));
+
                 break;
             }
         }
@@ -313,6 +412,95 @@ std::map<std::string, evget::DeviceType> evget::Cli::DeviceTypeMappings() {
     };
 }
 
+std::vector<std::string> evget::Cli::SQLiteProfileDescriptions() {
+    return {
+        "- default: keep the SQLite defaults",
+        "- throughput: WAL, synchronous=NORMAL, 64 MiB cache, 256 MiB mmap and in-memory temp storage. "
+        "Recent transactions may be lost on power failure, but the database is not corrupted",
+        "- durable: WAL, synchronous=FULL, every transaction is synced to disk",
+    };
+}
+
+std::map<std::string, evget::SQLiteProfile> evget::Cli::SQLiteProfileMappings() {
+    return {
+        {"default", SQLiteProfile::kDefault},
+        {"throughput", SQLiteProfile::kThroughput},
+        {"durable", SQLiteProfile::kDurable},
+    };
+}
+
+std::string evget::Cli::ToString(evget::SQLiteProfile profile) {
+    switch (profile) {
+        case SQLiteProfile::kDefault:
+            return "default";
+        case SQLiteProfile::kThroughput:
+            return "throughput";
+        case SQLiteProfile::kDurable:
+            return "durable";
+    }
+    return {};
+}
+
+std::vector<std::string> evget::Cli::OverflowPolicyDescriptions() {
+    return {
+        "- block: pause capture until the outputs catch up, never losing events",
+        "- drop-oldest: drop the oldest buffered events",
+        "- drop-mouse-moves: drop buffered mouse moves first, then the oldest events",
+        "- coalesce-moves: keep only the last of consecutive buffered mouse moves, then pause capture",
+    };
+}
+
+std::map<std::string, evget::OverflowPolicy> evget::Cli::OverflowPolicyMappings() {
+    return {
+        {"block", OverflowPolicy::kBlock},
+        {"drop-oldest", OverflowPolicy::kDropOldest},
+        {"drop-mouse-moves", OverflowPolicy::kDropMouseMoves},
+        {"coalesce-moves", OverflowPolicy::kCoalesceMoves},
+    };
+}
+
+std::string evget::Cli::ToString(evget::OverflowPolicy policy) {
+    switch (policy) {
+        case OverflowPolicy::kBlock:
+            return "block";
+        case OverflowPolicy::kDropOldest:
+            return "drop-oldest";
+        case OverflowPolicy::kDropMouseMoves:
+            return "drop-mouse-moves";
+        case OverflowPolicy::kCoalesceMoves:
+            return "coalesce-moves";
+    }
+    return {};
+}
+
+std::vector<std::string> evget::Cli::StreamModeDescriptions() {
+    return {
+        "- auto: stream stdout and buffer every other output",
+        "- all: stream every output",
+        "- none: buffer every output",
+    };
+}
+
+std::map<std::string, evget::StreamMode> evget::Cli::StreamModeMappings() {
+    return {
+        {"auto", StreamMode::kAuto},
+        {"all", StreamMode::kAll},
+        {"none", StreamMode::kNone},
+    };
+}
+
+std::string evget::Cli::ToString(StreamMode mode) {
+    switch (mode) {
+        case StreamMode::kAuto:
+            return "auto";
+        case StreamMode::kAll:
+            return "all";
+        case StreamMode::kNone:
+            return "none";
+    }
+    return {};
+}
+
 evget::EventSource evget::Cli::EventSource() const {
     return event_source_;
 }
@@ -321,8 +509,20 @@ std::size_t evget::Cli::StoreNEvents() const {
     return store_n_events_;
 }
 
-std::chrono::seconds evget::Cli::StoreAfter() const {
-    return std::chrono::seconds{store_after_};
+std::size_t evget::Cli::StoreNBytes() const {
+    return store_n_bytes_;
+}
+
+std::chrono::milliseconds evget::Cli::StoreAfter() const {
+    return std::chrono::milliseconds{store_after_ms_};
+}
+
+bool evget::Cli::StoreAdaptive() const {
+    return store_adaptive_;
+}
+
+evget::StreamMode evget::Cli::Stream() const {
+    return stream_;
 }
 
 std::optional<std::pair<std::uint32_t, std::uint32_t>> evget::Cli::ScreenDimensions() const {
@@ -340,3 +540,11 @@ const std::optional<std::string>& evget::Cli::Seat() const {
 const std::optional<std::set<evget::DeviceType>>& evget::Cli::Filter() const {
     return filter_;
 }
+
+evget::SQLiteProfile evget::Cli::SQLiteProfile() const {
+    return sqlite_profile_;
+}
+
+evget::BufferLimits evget::Cli::BufferLimits() const {
+    return {.max_events = buffer_events_, .max_bytes = buffer_bytes_, .policy = overflow_policy_};
+}
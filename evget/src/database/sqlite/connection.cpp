@@ -2,7 +2,9 @@
 
 #include <SQLiteCpp/Database.h>
 #include <spdlog/spdlog.h>
+#include <sqlite3.h>
 
+#include <cstddef>
 #include <exception>
 #include <filesystem>
 #include <functional>
@@ -14,8 +16,11 @@
 #include "evget/database/connection.h"
 #include "evget/database/query.h"
 #include "evget/database/sqlite/query.h"
+#include "evget/database/sqlite/tuning.h"
 #include "evget/error.h"
 
+evget::SQLiteConnection::SQLiteConnection(SQLiteTuning tuning) : tuning_{std::move(tuning)} {}
+
 evget::Result<void> evget::SQLiteConnection::Connect(std::filesystem::path database, ConnectOptions options) {
     try {
         auto database_string = database.string();
@@ -33,9 +38,16 @@ evget::Result<void> evget::SQLiteConnection::Connect(std::filesystem::path datab
                 break;
         }
 
+        for (const auto& pragma : tuning_.Pragmas(options == ConnectOptions::kReadOnly)) {
+            spdlog::debug("applying SQLite setting: {}", pragma);
+            this->database_->exec(pragma);
+        }
+
         spdlog::info("connected to SQLite database: {}", database_string);
         return {};
     } catch (std::exception& e) {
+        this->database_.reset();
+
         const auto* what = e.what();
         spdlog::error("error connecting to SQLite database: {}", what);
         return ConnectError(what);
@@ -82,6 +94,20 @@ std::unique_ptr<evget::Query> evget::SQLiteConnection::BuildQuery(std::string qu
     return std::make_unique<SQLiteQuery>(*this, std::move(query));
 }
 
+evget::Result<std::size_t> evget::SQLiteConnection::MaxBindParameters() {
+    if (!this->database_.has_value()) {
+        return ConnectError("no database connected");
+    }
+
+    // A negative new value only queries the limit without changing it.
+    auto limit = sqlite3_limit(this->database_->getHandle(), SQLITE_LIMIT_VARIABLE_NUMBER, -1);
+    if (limit <= 0) {
+        return ConnectError("invalid variable number limit");
+    }
+
+    return static_cast<std::size_t>(limit);
+}
+
 evget::Err evget::SQLiteConnection::ConnectError(const char* message) {
     return Err{Error{.error_type = ErrorType::kDatabaseError, .message = message}};
 }
@@ -2,10 +2,13 @@
 
 #include <spdlog/spdlog.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <exception>
+#include <functional>
+#include <span>
 #include <string>
 #include <utility>
-#include <variant>
 
 #include "evget/database/sqlite/connection.h"
 #include "evget/error.h"
@@ -13,24 +16,66 @@
 evget::SQLiteQuery::SQLiteQuery(SQLiteConnection& connection, std::string query)
     : connection_{connection}, query_{std::move(query)} {}
 
+template <bool NoCopy, typename... T>
+void evget::SQLiteQuery::Bind(int position, T... value) {
+    // Only the first error is kept until it is returned by `Next`.
+    if (bind_error_.has_value()) {
+        return;
+    }
+
+    auto statement = PrepareStatement();
+    if (!statement.has_value()) {
+        bind_error_ = statement.error();
+        return;
+    }
+
+    try {
+        if constexpr (NoCopy) {
+            statement->get().bindNoCopy(position + 1, value...);
+        } else {
+            statement->get().bind(position + 1, value...);
+        }
+    } catch (std::exception& e) {
+        const auto* what = e.what();
+        spdlog::error("error binding value: {}", what);
+        bind_error_ = Error{.error_type = ErrorType::kDatabaseError, .message = what};
+    }
+}
+
 void evget::SQLiteQuery::BindInt(int position, int value) {
-    binds_[position] = value;
+    Bind(position, value);
+}
+
+void evget::SQLiteQuery::BindInt64(int position, std::int64_t value) {
+    Bind(position, value);
 }
 
 void evget::SQLiteQuery::BindBool(int position, bool value) {
-    binds_[position] = value;
+    Bind(position, static_cast<int>(value));
 }
 
 void evget::SQLiteQuery::BindChars(int position, const char* value) {
-    binds_[position] = value;
+    Bind(position, value);
+}
+
+void evget::SQLiteQuery::BindStaticChars(int position, const char* value) {
+    Bind<true>(position, value);
 }
 
 void evget::SQLiteQuery::BindDouble(int position, double value) {
-    binds_[position] = value;
+    Bind(position, value);
+}
+
+void evget::SQLiteQuery::BindNull(int position) {
+    Bind(position);
+}
+
+void evget::SQLiteQuery::BindBlob(int position, std::span<const std::byte> value) {
+    Bind(position, static_cast<const void*>(value.data()), static_cast<int>(value.size()));
 }
 
 evget::Result<void> evget::SQLiteQuery::Reset() {
-    this->binds_.clear();
+    this->bind_error_.reset();
 
     try {
         if (statement_.has_value()) {
@@ -46,23 +91,18 @@ evget::Result<void> evget::SQLiteQuery::Reset() {
     return {};
 }
 
-evget::Result<bool> evget::SQLiteQuery::Next() {
-    try {
-        auto database = connection_.get().Database();
-        if (!database.has_value()) {
-            return Err{{.error_type = ErrorType::kDatabaseError, .message = "database not set"}};
-        }
-        if (!statement_.has_value()) {
-            statement_.emplace(database->get(), query_);
-        }
+evget::Result<std::reference_wrapper<SQLite::Statement>> evget::SQLiteQuery::PrepareStatement() {
+    if (statement_.has_value()) {
+        return std::ref(*statement_);
+    }
 
-        auto& statement = statement_.value();
-        for (auto& [position, bind_value] : this->binds_) {
-            std::visit([&statement, pos = position](auto&& inner) { statement.bind(pos + 1, inner); }, bind_value);
-        }
-        this->binds_.clear();
+    auto database = connection_.get().Database();
+    if (!database.has_value()) {
+        return Err{{.error_type = ErrorType::kDatabaseError, .message = "database not set"}};
+    }
 
-        return statement.executeStep();
+    try {
+        return std::ref(statement_.emplace(database->get(), query_));
     } catch (std::exception& e) {
         const auto* what = e.what();
         spdlog::error("error building query: {}", what);
@@ -70,6 +110,24 @@ evget::Result<bool> evget::SQLiteQuery::Next() {
     }
 }
 
+evget::Result<bool> evget::SQLiteQuery::Next() {
+    if (bind_error_.has_value()) {
+        auto error = *bind_error_;
+        bind_error_.reset();
+        return Err{error};
+    }
+
+    return PrepareStatement().and_then([](SQLite::Statement& statement) -> Result<bool> {
+        try {
+            return statement.executeStep();
+        } catch (std::exception& e) {
+            const auto* what = e.what();
+            spdlog::error("error executing query: {}", what);
+            return Err{{.error_type = ErrorType::kDatabaseError, .message = what}};
+        }
+    });
+}
+
 evget::Result<void> evget::SQLiteQuery::NextWhile() {
     auto next = this->Next();
     while (next.has_value() && *next) {
@@ -0,0 +1,101 @@
+#include "evget/database/sqlite/tuning.h"
+
+#include <cstdint>
+#include <format>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr std::int64_t kThroughputCacheSize = -64 * 1024;
+constexpr std::int64_t kThroughputPageSize = 8192;
+constexpr std::int64_t kThroughputMmapSize = 256LL * 1024 * 1024;
+
+constexpr const char* ToString(evget::SQLiteJournalMode journal_mode) {
+    switch (journal_mode) {
+        case evget::SQLiteJournalMode::kDelete:
+            return "delete";
+        case evget::SQLiteJournalMode::kWal:
+            return "wal";
+    }
+    return "delete";
+}
+
+constexpr const char* ToString(evget::SQLiteSynchronous synchronous) {
+    switch (synchronous) {
+        case evget::SQLiteSynchronous::kOff:
+            return "off";
+        case evget::SQLiteSynchronous::kNormal:
+            return "normal";
+        case evget::SQLiteSynchronous::kFull:
+            return "full";
+        case evget::SQLiteSynchronous::kExtra:
+            return "extra";
+    }
+    return "full";
+}
+
+constexpr const char* ToString(evget::SQLiteTempStore temp_store) {
+    switch (temp_store) {
+        case evget::SQLiteTempStore::kDefault:
+            return "default";
+        case evget::SQLiteTempStore::kFile:
+            return "file";
+        case evget::SQLiteTempStore::kMemory:
+            return "memory";
+    }
+    return "default";
+}
+} // namespace
+
+evget::SQLiteTuning evget::SQLiteTuning::FromProfile(SQLiteProfile profile) {
+    switch (profile) {
+        case SQLiteProfile::kDefault:
+            return {};
+        case SQLiteProfile::kThroughput:
+            return {
+                .journal_mode = SQLiteJournalMode::kWal,
+                .synchronous = SQLiteSynchronous::kNormal,
+                .cache_size = kThroughputCacheSize,
+                .page_size = kThroughputPageSize,
+                .mmap_size = kThroughputMmapSize,
+                .temp_store = SQLiteTempStore::kMemory,
+            };
+        case SQLiteProfile::kDurable:
+            return {
+                .journal_mode = SQLiteJournalMode::kWal,
+                .synchronous = SQLiteSynchronous::kFull,
+                .cache_size = std::nullopt,
+                .page_size = std::nullopt,
+                .mmap_size = std::nullopt,
+                .temp_store = std::nullopt,
+            };
+    }
+    return {};
+}
+
+std::vector<std::string> evget::SQLiteTuning::Pragmas(bool read_only) const {
+    std::vector<std::string> pragmas{};
+
+    // The page size must be set before the journal mode, as it cannot change once the database is in WAL mode.
+    if (!read_only && page_size.has_value()) {
+        pragmas.emplace_back(std::format("pragma page_size = {};", *page_size));
+    }
+    if (!read_only && journal_mode.has_value()) {
+        pragmas.emplace_back(std::format("pragma journal_mode = {};", ToString(*journal_mode)));
+    }
+    if (synchronous.has_value()) {
+        pragmas.emplace_back(std::format("pragma synchronous = {};", ToString(*synchronous)));
+    }
+    if (cache_size.has_value()) {
+        pragmas.emplace_back(std::format("pragma cache_size = {};", *cache_size));
+    }
+    if (mmap_size.has_value()) {
+        pragmas.emplace_back(std::format("pragma mmap_size = {};", *mmap_size));
+    }
+    if (temp_store.has_value()) {
+        pragmas.emplace_back(std::format("pragma temp_store = {};", ToString(*temp_store)));
+    }
+
+    return pragmas;
+}
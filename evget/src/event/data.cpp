@@ -1,29 +1,98 @@
 #include "evget/event/data.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
 #include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <string>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "evget/event/entry.h"
+#include "evget/event/modifier_value.h"
+
+evget::Data::Data(std::shared_ptr<std::pmr::memory_resource> arena) : arena_{std::move(arena)} {}
+
+evget::Data::Data(const Data& other) : entries_{other.entries_} {}
+
+evget::Data& evget::Data::operator=(const Data& other) {
+    // Existing entries keep their memory resource when assigned to, so the arenas of this object stay alive.
+    entries_ = other.entries_;
+    return *this;
+}
 
 const std::vector<evget::Entry>& evget::Data::Entries() const {
     return entries_;
 }
 
 void evget::Data::MergeWith(Data&& data) {
-    auto entries = std::move(data).IntoEntries();
-    this->entries_
-        .insert(this->entries_.end(), std::make_move_iterator(entries.begin()), std::make_move_iterator(entries.end()));
+    Retain(std::move(data.arena_));
+    for (auto& arena : data.retained_) {
+        Retain(std::move(arena));
+    }
+
+    this->entries_.insert(
+        this->entries_.end(),
+        std::make_move_iterator(data.entries_.begin()),
+        std::make_move_iterator(data.entries_.end())
+    );
+    data.entries_.clear();
 }
 
 std::vector<evget::Entry> evget::Data::IntoEntries() && {
-    return std::move(entries_);
+    if (arena_ == nullptr && retained_.empty()) {
+        return std::move(entries_);
+    }
+
+    // Entries do not keep their arena alive, so copy them out of it.
+    return entries_;
 }
 
 void evget::Data::AddEntry(Entry entry) {
     entries_.push_back(std::move(entry));
 }
 
+void evget::Data::AddEntry(EntryType type, std::initializer_list<FieldValue> data, ModifierSet modifiers) {
+    entries_.emplace_back(type, std::pmr::vector<FieldValue>{data, Resource()}, modifiers);
+}
+
+std::pmr::memory_resource* evget::Data::Resource() const {
+    return arena_ != nullptr ? arena_.get() : std::pmr::get_default_resource();
+}
+
+void evget::Data::Retain(std::shared_ptr<std::pmr::memory_resource> arena) {
+    if (arena == nullptr || arena == arena_ || std::ranges::find(retained_, arena) != retained_.end()) {
+        return;
+    }
+    retained_.push_back(std::move(arena));
+}
+
+void evget::Data::Reserve(std::size_t n_entries) {
+    entries_.reserve(n_entries);
+}
+
+std::size_t evget::Data::Size() const {
+    return entries_.size();
+}
+
+std::size_t evget::Data::Footprint() const {
+    auto bytes = entries_.capacity() * sizeof(Entry);
+    for (const auto& entry : entries_) {
+        bytes += entry.Data().capacity() * sizeof(FieldValue);
+        for (const auto& value : entry.Data()) {
+            // Only strings that outgrow the small string buffer allocate, including their null terminator.
+            if (const auto* string = std::get_if<std::string>(&value);
+                string != nullptr && string->capacity() > std::string{}.capacity()) {
+                bytes += string->capacity() + 1;
+            }
+        }
+    }
+    return bytes;
+}
+
 bool evget::Data::Empty() const {
     return entries_.empty();
 }
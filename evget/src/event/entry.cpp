@@ -1,72 +1,59 @@
 #include "evget/event/entry.h"
 
 #include <algorithm>
+#include <iterator>
+#include <memory_resource>
+#include <span>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
-#include "evget/event/button_action.h"
-#include "evget/event/device_type.h"
 #include "evget/event/modifier_value.h"
 #include "evget/event/schema.h"
 
-evget::Entry::Entry(EntryType type, const std::vector<std::string>& data, std::vector<std::string> modifiers)
-    : type_{type}, data_{data}, modifiers_{std::move(modifiers)} {}
+evget::Entry::Entry(EntryType type, std::pmr::vector<FieldValue> data, ModifierSet modifiers)
+    : type_{type}, data_{std::move(data)}, modifiers_{modifiers} {}
 
-const std::vector<std::string>& evget::Entry::Data() const {
+const std::pmr::vector<evget::FieldValue>& evget::Entry::Data() const {
     return data_;
 }
 
-const std::vector<std::string>& evget::Entry::Modifiers() const {
+evget::ModifierSet evget::Entry::Modifiers() const {
     return modifiers_;
 }
 
-void evget::Entry::ToNamedRepresentation() {
-    if (data_.size() > detail::kDeviceTypeIndex) {
-        data_.at(detail::kDeviceTypeIndex) = FromDevice(FromUnderlying<DeviceType>(data_.at(detail::kDeviceTypeIndex)));
-    }
-
-    // button_action position depends on the entry type.
-    switch (type_) {
-        case EntryType::kMouseClick:
-            if (data_.size() >= detail::kMouseClickNFields) {
-                constexpr auto kIndex = detail::kMouseClickNFields - 1;
-                data_.at(kIndex) = FromButtonAction(FromUnderlying<ButtonAction>(data_.at(kIndex)));
-            }
-            break;
-        case EntryType::kKey:
-            if (data_.size() >= detail::kKeyNFields) {
-                constexpr auto kIndex = detail::kKeyNFields - 1;
-                data_.at(kIndex) = FromButtonAction(FromUnderlying<ButtonAction>(data_.at(kIndex)));
-            }
-            break;
-        default:
-            break;
-    }
-
-    std::ranges::for_each(modifiers_, [](std::string& modifier) {
-        modifier = FromModifierValue(FromUnderlying<ModifierValue>(modifier));
-    });
-}
-
-evget::EntryWithFields evget::Entry::GetEntryWithFields() const {
-    std::vector<std::string> fields;
+std::span<const std::string_view> evget::Entry::FieldNames() const {
     switch (this->Type()) {
         case EntryType::kKey:
-            fields = {detail::kKeyFields.begin(), detail::kKeyFields.end()};
-            break;
+            return detail::kKeyFields;
         case EntryType::kMouseClick:
-            fields = {detail::kMouseClickFields.begin(), detail::kMouseClickFields.end()};
-            break;
+            return detail::kMouseClickFields;
         case EntryType::kMouseMove:
-            fields = {detail::kMouseMoveFields.begin(), detail::kMouseMoveFields.end()};
-            break;
+            return detail::kMouseMoveFields;
         case EntryType::kMouseScroll:
-            fields = {detail::kMouseScrollFields.begin(), detail::kMouseScrollFields.end()};
-            break;
+            return detail::kMouseScrollFields;
     }
+    return {};
+}
+
+evget::EntryWithFields evget::Entry::GetEntryWithFields() const {
+    auto names = this->FieldNames();
+    std::vector<std::string> fields{names.begin(), names.end()};
+
+    std::vector<std::string> data;
+    data.reserve(data_.size());
+    std::ranges::transform(data_, std::back_inserter(data), [](const FieldValue& value) {
+        return FromFieldValue(value);
+    });
+
+    std::vector<std::string> modifiers;
+    modifiers.reserve(modifiers_.Size());
+    std::ranges::transform(modifiers_.Values(), std::back_inserter(modifiers), [](ModifierValue modifier) {
+        return FromModifierValue(modifier);
+    });
 
-    return {.type = this->Type(), .fields = fields, .data = Data(), .modifiers = Modifiers()};
+    return {.type = this->Type(), .fields = fields, .data = data, .modifiers = modifiers};
 }
 
 evget::EntryType evget::Entry::Type() const {
@@ -0,0 +1,77 @@
+#include "evget/event/interned_string.h"
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+
+evget::InternedString::InternedString(std::string_view value) : InternedString{StringPool::Global().Intern(value)} {}
+
+evget::InternedString::InternedString(const char* value) : InternedString{std::string_view{value}} {}
+
+evget::InternedString::InternedString(const std::string& value) : InternedString{std::string_view{value}} {}
+
+evget::InternedString::InternedString(std::uint32_t id, std::string_view value) : value_{value}, id_{id} {}
+
+std::string_view evget::InternedString::View() const {
+    return value_;
+}
+
+std::uint32_t evget::InternedString::Id() const {
+    return id_;
+}
+
+bool evget::InternedString::operator==(const InternedString& other) const {
+    return id_ == other.id_;
+}
+
+bool evget::InternedString::operator==(std::string_view other) const {
+    return value_ == other;
+}
+
+std::strong_ordering evget::InternedString::operator<=>(const InternedString& other) const {
+    return id_ <=> other.id_;
+}
+
+std::ostream& evget::operator<<(std::ostream& ostream, const InternedString& value) {
+    return ostream << value.View();
+}
+
+evget::StringPool::StringPool() {
+    // The empty string has id zero so that default constructed handles compare equal to it.
+    Intern("");
+}
+
+evget::StringPool& evget::StringPool::Global() {
+    static StringPool pool{};
+    return pool;
+}
+
+evget::InternedString evget::StringPool::Intern(std::string_view value) {
+    {
+        const std::shared_lock lock{mutex_};
+        if (auto interned = ids_.find(value); interned != ids_.end()) {
+            return {interned->second, interned->first};
+        }
+    }
+
+    const std::unique_lock lock{mutex_};
+    // Another thread may have interned the same string between the locks.
+    if (auto interned = ids_.find(value); interned != ids_.end()) {
+        return {interned->second, interned->first};
+    }
+
+    auto id = static_cast<std::uint32_t>(strings_.size());
+    const auto& stored = strings_.emplace_back(value);
+    auto [interned, _] = ids_.emplace(stored, id);
+    return {interned->second, interned->first};
+}
+
+std::size_t evget::StringPool::Size() const {
+    const std::shared_lock lock{mutex_};
+    return strings_.size();
+}
@@ -8,6 +8,7 @@
 #include "evget/event/data.h"
 #include "evget/event/device_type.h"
 #include "evget/event/entry.h"
+#include "evget/event/interned_string.h"
 #include "evget/event/modifier_value.h"
 #include "evget/event/schema.h"
 
@@ -51,17 +52,17 @@ evget::Key& evget::Key::Button(int button) {
     return *this;
 }
 
-evget::Key& evget::Key::ButtonName(std::string name) {
+evget::Key& evget::Key::ButtonName(InternedString name) {
     name_ = std::move(name);
     return *this;
 }
 
-evget::Key& evget::Key::Character(std::string character) {
+evget::Key& evget::Key::Character(InternedString character) {
     character_ = std::move(character);
     return *this;
 }
 
-evget::Key& evget::Key::DeviceName(std::string device_name) {
+evget::Key& evget::Key::DeviceName(InternedString device_name) {
     device_name_ = std::move(device_name);
     return *this;
 }
@@ -96,54 +97,52 @@ evget::Key& evget::Key::Screen(int screen) {
     return *this;
 }
 
-evget::Key& evget::Key::DeviceId(std::string device_id) {
+evget::Key& evget::Key::DeviceId(InternedString device_id) {
     device_id_ = std::move(device_id);
     return *this;
 }
 
 evget::Key& evget::Key::Modifier(ModifierValue modifier_value) {
-    modifiers_.push_back(ToUnderlying(modifier_value));
+    modifiers_.Insert(modifier_value);
     return *this;
 }
 
-evget::Key& evget::Key::SystemEvent(std::string system_event) {
+evget::Key& evget::Key::SystemEvent(InternedString system_event) {
     system_event_ = std::move(system_event);
     return *this;
 }
 
-evget::Key& evget::Key::EventSource(std::string event_source) {
+evget::Key& evget::Key::EventSource(InternedString event_source) {
     event_source_ = std::move(event_source);
     return *this;
 }
 
 evget::Data& evget::Key::Build(Data& data) const {
-    const Entry entry{
+    data.AddEntry(
         EntryType::kKey,
         {
-            FromInterval(interval_),
-            FromTimestamp(timestamp_),
-            FromDouble(position_x_),
-            FromDouble(position_y_),
-            FromString(device_name_),
-            FromString(focus_window_name_),
-            FromDouble(focus_window_position_x_),
-            FromDouble(focus_window_position_y_),
-            FromDouble(focus_window_width_),
-            FromDouble(focus_window_height_),
-            FromInt(screen_),
-            FromString(device_id_),
-            FromString(system_event_),
-            FromString(event_source_),
-            ToUnderlyingOptional(device_),
-            FromInt(button_),
-            FromString(name_),
-            FromString(character_),
-            ToUnderlyingOptional(action_),
+            ToFieldValue(interval_),
+            ToFieldValue(timestamp_),
+            ToFieldValue(position_x_),
+            ToFieldValue(position_y_),
+            ToFieldValue(device_name_),
+            ToFieldValue(focus_window_name_),
+            ToFieldValue(focus_window_position_x_),
+            ToFieldValue(focus_window_position_y_),
+            ToFieldValue(focus_window_width_),
+            ToFieldValue(focus_window_height_),
+            ToFieldValue(screen_),
+            ToFieldValue(device_id_),
+            ToFieldValue(system_event_),
+            ToFieldValue(event_source_),
+            ToFieldValue(device_),
+            ToFieldValue(button_),
+            ToFieldValue(name_),
+            ToFieldValue(character_),
+            ToFieldValue(action_),
         },
         modifiers_
-    };
-
-    data.AddEntry(entry);
+    );
 
     return data;
 }
@@ -8,6 +8,7 @@
 #include "evget/event/data.h"
 #include "evget/event/device_type.h"
 #include "evget/event/entry.h"
+#include "evget/event/interned_string.h"
 #include "evget/event/modifier_value.h"
 #include "evget/event/schema.h"
 
@@ -51,12 +52,12 @@ evget::MouseClick& evget::MouseClick::Button(int button) {
     return *this;
 }
 
-evget::MouseClick& evget::MouseClick::ButtonName(std::string name) {
+evget::MouseClick& evget::MouseClick::ButtonName(InternedString name) {
     name_ = std::move(name);
     return *this;
 }
 
-evget::MouseClick& evget::MouseClick::DeviceName(std::string device_name) {
+evget::MouseClick& evget::MouseClick::DeviceName(InternedString device_name) {
     device_name_ = std::move(device_name);
     return *this;
 }
@@ -86,7 +87,7 @@ evget::MouseClick& evget::MouseClick::FocusWindowHeight(double height) {
     return *this;
 }
 
-evget::MouseClick& evget::MouseClick::DeviceId(std::string device_id) {
+evget::MouseClick& evget::MouseClick::DeviceId(InternedString device_id) {
     device_id_ = std::move(device_id);
     return *this;
 }
@@ -97,7 +98,7 @@ evget::MouseClick& evget::MouseClick::TouchId(int touch_id) {
 }
 
 evget::MouseClick& evget::MouseClick::Modifier(ModifierValue modifier_value) {
-    modifiers_.push_back(ToUnderlying(modifier_value));
+    modifiers_.Insert(modifier_value);
     return *this;
 }
 
@@ -106,44 +107,42 @@ evget::MouseClick& evget::MouseClick::Screen(int screen) {
     return *this;
 }
 
-evget::MouseClick& evget::MouseClick::SystemEvent(std::string system_event) {
+evget::MouseClick& evget::MouseClick::SystemEvent(InternedString system_event) {
     system_event_ = std::move(system_event);
     return *this;
 }
 
-evget::MouseClick& evget::MouseClick::EventSource(std::string event_source) {
+evget::MouseClick& evget::MouseClick::EventSource(InternedString event_source) {
     event_source_ = std::move(event_source);
     return *this;
 }
 
 evget::Data& evget::MouseClick::Build(Data& data) const {
-    const Entry entry{
+    data.AddEntry(
         EntryType::kMouseClick,
         {
-            FromInterval(interval_),
-            FromTimestamp(timestamp_),
-            FromDouble(position_x_),
-            FromDouble(position_y_),
-            FromString(device_name_),
-            FromString(focus_window_name_),
-            FromDouble(focus_window_position_x_),
-            FromDouble(focus_window_position_y_),
-            FromDouble(focus_window_width_),
-            FromDouble(focus_window_height_),
-            FromInt(screen_),
-            FromString(device_id_),
-            FromString(system_event_),
-            FromString(event_source_),
-            ToUnderlyingOptional(device_),
-            FromInt(touch_id_),
-            FromInt(button_),
-            FromString(name_),
-            ToUnderlyingOptional(action_),
+            ToFieldValue(interval_),
+            ToFieldValue(timestamp_),
+            ToFieldValue(position_x_),
+            ToFieldValue(position_y_),
+            ToFieldValue(device_name_),
+            ToFieldValue(focus_window_name_),
+            ToFieldValue(focus_window_position_x_),
+            ToFieldValue(focus_window_position_y_),
+            ToFieldValue(focus_window_width_),
+            ToFieldValue(focus_window_height_),
+            ToFieldValue(screen_),
+            ToFieldValue(device_id_),
+            ToFieldValue(system_event_),
+            ToFieldValue(event_source_),
+            ToFieldValue(device_),
+            ToFieldValue(touch_id_),
+            ToFieldValue(button_),
+            ToFieldValue(name_),
+            ToFieldValue(action_),
         },
         modifiers_
-    };
-
-    data.AddEntry(entry);
+    );
 
     return data;
 }
@@ -7,6 +7,7 @@
 #include "evget/event/data.h"
 #include "evget/event/device_type.h"
 #include "evget/event/entry.h"
+#include "evget/event/interned_string.h"
 #include "evget/event/modifier_value.h"
 #include "evget/event/schema.h"
 
@@ -40,7 +41,7 @@ evget::MouseMove& evget::MouseMove::PositionY(double y_pos) {
     return *this;
 }
 
-evget::MouseMove& evget::MouseMove::DeviceName(std::string device_name) {
+evget::MouseMove& evget::MouseMove::DeviceName(InternedString device_name) {
     device_name_ = std::move(device_name);
     return *this;
 }
@@ -75,7 +76,7 @@ evget::MouseMove& evget::MouseMove::Screen(int screen) {
     return *this;
 }
 
-evget::MouseMove& evget::MouseMove::DeviceId(std::string device_id) {
+evget::MouseMove& evget::MouseMove::DeviceId(InternedString device_id) {
     device_id_ = std::move(device_id);
     return *this;
 }
@@ -86,43 +87,41 @@ evget::MouseMove& evget::MouseMove::TouchId(int touch_id) {
 }
 
 evget::MouseMove& evget::MouseMove::Modifier(ModifierValue modifier_value) {
-    modifiers_.push_back(ToUnderlying(modifier_value));
+    modifiers_.Insert(modifier_value);
     return *this;
 }
 
-evget::MouseMove& evget::MouseMove::SystemEvent(std::string system_event) {
+evget::MouseMove& evget::MouseMove::SystemEvent(InternedString system_event) {
     system_event_ = std::move(system_event);
     return *this;
 }
 
-evget::MouseMove& evget::MouseMove::EventSource(std::string event_source) {
+evget::MouseMove& evget::MouseMove::EventSource(InternedString event_source) {
     event_source_ = std::move(event_source);
     return *this;
 }
 
 evget::Data& evget::MouseMove::Build(Data& data) const {
-    const Entry entry{
+    data.AddEntry(
         EntryType::kMouseMove,
-        {FromInterval(interval_),
-         FromTimestamp(timestamp_),
-         FromDouble(position_x_),
-         FromDouble(position_y_),
-         FromString(device_name_),
-         FromString(focus_window_name_),
-         FromDouble(focus_window_position_x_),
-         FromDouble(focus_window_position_y_),
-         FromDouble(focus_window_width_),
-         FromDouble(focus_window_height_),
-         FromInt(screen_),
-         FromString(device_id_),
-         FromString(system_event_),
-         FromString(event_source_),
-         ToUnderlyingOptional(device_),
-         FromInt(touch_id_)},
+        {ToFieldValue(interval_),
+         ToFieldValue(timestamp_),
+         ToFieldValue(position_x_),
+         ToFieldValue(position_y_),
+         ToFieldValue(device_name_),
+         ToFieldValue(focus_window_name_),
+         ToFieldValue(focus_window_position_x_),
+         ToFieldValue(focus_window_position_y_),
+         ToFieldValue(focus_window_width_),
+         ToFieldValue(focus_window_height_),
+         ToFieldValue(screen_),
+         ToFieldValue(device_id_),
+         ToFieldValue(system_event_),
+         ToFieldValue(event_source_),
+         ToFieldValue(device_),
+         ToFieldValue(touch_id_)},
         modifiers_
-    };
-
-    data.AddEntry(entry);
+    );
 
     return data;
 }
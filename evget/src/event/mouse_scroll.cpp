@@ -7,6 +7,7 @@
 #include "evget/event/data.h"
 #include "evget/event/device_type.h"
 #include "evget/event/entry.h"
+#include "evget/event/interned_string.h"
 #include "evget/event/modifier_value.h"
 #include "evget/event/schema.h"
 
@@ -50,7 +51,7 @@ evget::MouseScroll& evget::MouseScroll::Horizontal(double amount) {
     return *this;
 }
 
-evget::MouseScroll& evget::MouseScroll::DeviceName(std::string device_name) {
+evget::MouseScroll& evget::MouseScroll::DeviceName(InternedString device_name) {
     device_name_ = std::move(device_name);
     return *this;
 }
@@ -80,13 +81,13 @@ evget::MouseScroll& evget::MouseScroll::FocusWindowHeight(double height) {
     return *this;
 }
 
-evget::MouseScroll& evget::MouseScroll::DeviceId(std::string device_id) {
+evget::MouseScroll& evget::MouseScroll::DeviceId(InternedString device_id) {
     device_id_ = std::move(device_id);
     return *this;
 }
 
 evget::MouseScroll& evget::MouseScroll::Modifier(ModifierValue modifier_value) {
-    modifiers_.push_back(ToUnderlying(modifier_value));
+    modifiers_.Insert(modifier_value);
     return *this;
 }
 
@@ -95,40 +96,38 @@ evget::MouseScroll& evget::MouseScroll::Screen(int screen) {
     return *this;
 }
 
-evget::MouseScroll& evget::MouseScroll::SystemEvent(std::string system_event) {
+evget::MouseScroll& evget::MouseScroll::SystemEvent(InternedString system_event) {
     system_event_ = std::move(system_event);
     return *this;
 }
 
-evget::MouseScroll& evget::MouseScroll::EventSource(std::string event_source) {
+evget::MouseScroll& evget::MouseScroll::EventSource(InternedString event_source) {
     event_source_ = std::move(event_source);
     return *this;
 }
 
 evget::Data& evget::MouseScroll::Build(Data& data) const {
-    const Entry entry{
+    data.AddEntry(
         EntryType::kMouseScroll,
-        {FromInterval(interval_),
-         FromTimestamp(timestamp_),
-         FromDouble(position_x_),
-         FromDouble(position_y_),
-         FromString(device_name_),
-         FromString(focus_window_name_),
-         FromDouble(focus_window_position_x_),
-         FromDouble(focus_window_position_y_),
-         FromDouble(focus_window_width_),
-         FromDouble(focus_window_height_),
-         FromInt(screen_),
-         FromString(device_id_),
-         FromString(system_event_),
-         FromString(event_source_),
-         ToUnderlyingOptional(device_),
-         FromDouble(vertical_),
-         FromDouble(horizontal_)},
+        {ToFieldValue(interval_),
+         ToFieldValue(timestamp_),
+         ToFieldValue(position_x_),
+         ToFieldValue(position_y_),
+         ToFieldValue(device_name_),
+         ToFieldValue(focus_window_name_),
+         ToFieldValue(focus_window_position_x_),
+         ToFieldValue(focus_window_position_y_),
+         ToFieldValue(focus_window_width_),
+         ToFieldValue(focus_window_height_),
+         ToFieldValue(screen_),
+         ToFieldValue(device_id_),
+         ToFieldValue(system_event_),
+         ToFieldValue(event_source_),
+         ToFieldValue(device_),
+         ToFieldValue(vertical_),
+         ToFieldValue(horizontal_)},
         modifiers_
-    };
-
-    data.AddEntry(entry);
+    );
 
     return data;
 }
@@ -4,14 +4,19 @@
 
 #include <spdlog/spdlog.h>
 
+#include <cstddef>
 #include <exception>
+#include <functional>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "evget/async/scheduler/scheduler.h"
 #include "evget/cli.h"
 #include "evget/storage/database_manager.h"
+#include "evget/storage/fan_out_store.h"
 #include "evget/storage/filter_store.h"
+#include "evget/storage/store.h"
 
 #ifdef FEATURE_EVGETLIBINPUT
 #include "evgetlibinput/backend.h"
@@ -54,18 +59,46 @@ int main(int argc, char* argv[]) {
         spdlog::error(e.what());
         return 1;
     }
-    auto manager = evget::DatabaseManager{scheduler, {}, cli.StoreNEvents(), cli.StoreAfter()};
-
     auto stores = cli.ToStores();
     if (!stores.has_value()) {
         spdlog::error("{}", stores.error());
         return 1;
     }
-    for (auto&& store : *stores) {
+
+    // The buffer limits cover all events held in memory, so they are shared between the managers that are used.
+    auto n_managers = static_cast<std::size_t>(!stores->buffered.empty()) + (!stores->streamed.empty());
+    auto limits = cli.BufferLimits().Split(n_managers);
+    auto manager = evget::DatabaseManager{
+        scheduler,
+        {},
+        cli.StoreNEvents(),
+        cli.StoreNBytes(),
+        cli.StoreAfter(),
+        limits,
+        cli.StoreAdaptive() ? evget::FlushTimer::kAdaptive : evget::FlushTimer::kFixed
+    };
+    // Streamed outputs are written on every event. Events that arrive while a write is starting or in progress are
+    // written together in the next one, so a slow output still keeps up.
+    auto streaming = evget::DatabaseManager{scheduler, {}, 1, 0, cli.StoreAfter(), limits};
+
+    // The last manager receives events without a copy, in the arena it created them in, so put the buffered manager
+    // last. The streaming manager has no arena since it writes every event.
+    std::vector<std::reference_wrapper<evget::Store>> managers{};
+    if (!stores->streamed.empty()) {
+        managers.emplace_back(streaming);
+    }
+    if (!stores->buffered.empty()) {
+        managers.emplace_back(manager);
+    }
+    for (auto&& store : stores->buffered) {
         manager.AddStore(std::move(store));
     }
+    for (auto&& store : stores->streamed) {
+        streaming.AddStore(std::move(store));
+    }
 
-    auto filter = evget::FilterStore{manager, cli.Filter()};
+    auto fan_out = evget::FanOutStore{std::move(managers)};
+    auto filter = evget::FilterStore{fan_out, cli.Filter()};
     auto exit_code = 0;
     try {
         auto event_source = cli.EventSource();
@@ -117,6 +150,18 @@ int main(int argc, char* argv[]) {
 #endif
 
         scheduler->Join();
+
+        auto overflow = manager.Overflow();
+        auto streaming_overflow = streaming.Overflow();
+        overflow.dropped += streaming_overflow.dropped;
+        overflow.coalesced += streaming_overflow.coalesced;
+        if (overflow.dropped != 0 || overflow.coalesced != 0) {
+            spdlog::warn(
+                "buffer overflowed: {} events dropped, {} mouse moves coalesced",
+                overflow.dropped,
+                overflow.coalesced
+            );
+        }
     } catch (const std::exception& e) {
         spdlog::error("{}", e.what());
         exit_code = 1;
@@ -3,93 +3,512 @@
 #include <boost/asio/awaitable.hpp>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <expected>
-#include <format>
+#include <functional>
+#include <iterator>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
 #include <optional>
+#include <ranges>
 #include <utility>
 #include <vector>
 
-#include "evget/async/container/locking_vector.h"
+#include "evget/async/container/spsc_ring.h"
 #include "evget/async/scheduler/interval.h"
 #include "evget/async/scheduler/scheduler.h"
 #include "evget/error.h"
 #include "evget/event/data.h"
+#include "evget/event/entry.h"
+#include "evget/storage/buffer_limits.h"
 #include "evget/storage/store.h"
 
+namespace {
+// Each write latency sample contributes one part in this many to the moving average.
+constexpr std::chrono::microseconds::rep kLatencySmoothing{4};
+
+// The largest number of data values in an entry, used to size the first block of a window's arena.
+constexpr auto kArenaFieldsPerEntry = static_cast<std::size_t>(std::max(
+    {evget::detail::kKeyNFields,
+     evget::detail::kMouseClickNFields,
+     evget::detail::kMouseMoveNFields,
+     evget::detail::kMouseScrollNFields}
+));
+} // namespace
+
 evget::DatabaseManager::DatabaseManager(
     std::shared_ptr<Scheduler> scheduler,
     std::vector<std::shared_ptr<Store>> store_in,
     std::size_t n_events,
-    std::chrono::seconds store_after
+    std::size_t n_bytes,
+    std::chrono::milliseconds store_after,
+    BufferLimits limits,
+    FlushTimer timer
 )
     : scheduler_{std::move(scheduler)},
       store_in_{std::make_shared<StoresHolder>()},
       n_events_{n_events},
-      store_after_{store_after} {
-    store_in_->stores = std::move(store_in);
-    SpawnStoreAfter();
+      n_bytes_{n_bytes},
+      store_after_{store_after},
+      timer_{timer},
+      data_{std::make_shared<Buffer>(std::max(2 * n_events, kMinBufferCapacity), limits)} {
+    // The timer starts parked and is spawned by the first event.
+    for (auto& store : store_in) {
+        store_in_->stores.emplace_back(std::make_shared<StoreQueue>(std::move(store)));
+    }
+}
+
+evget::DatabaseManager::Buffer::Buffer(std::size_t capacity, BufferLimits limits) : ring{capacity}, limits{limits} {}
+
+void evget::DatabaseManager::Buffer::Acquire(std::size_t n_entries, std::size_t n_bytes) {
+    buffered.Acquire(n_entries, n_bytes);
+    usage->Acquire(n_entries, n_bytes);
+}
+
+void evget::DatabaseManager::Buffer::Release(std::size_t n_entries, std::size_t n_bytes) {
+    buffered.Release(n_entries, n_bytes);
+    usage->Release(n_entries, n_bytes);
+}
+
+void evget::DatabaseManager::Usage::Acquire(std::size_t n_entries, std::size_t n_bytes) {
+    // Sequentially consistent so that parking the timer cannot miss an event, see `ParkTimer`.
+    entries.fetch_add(n_entries);
+    bytes.fetch_add(n_bytes);
+}
+
+void evget::DatabaseManager::Usage::Release(std::size_t n_entries, std::size_t n_bytes) {
+    entries.fetch_sub(n_entries);
+    bytes.fetch_sub(n_bytes);
+}
+
+void evget::DatabaseManager::Usage::Notify() {
+    // Advance under the lock so that a producer cannot miss the notification between checking and waiting.
+    {
+        const std::scoped_lock guard{lock};
+        generation.fetch_add(1, std::memory_order_release);
+    }
+    released.notify_all();
+}
+
+void evget::DatabaseManager::Usage::WaitForRelease(std::uint64_t seen, std::chrono::milliseconds timeout) {
+    std::unique_lock guard{lock};
+    released.wait_for(guard, timeout, [this, seen] { return generation.load(std::memory_order_acquire) != seen; });
 }
 
-std::vector<std::shared_ptr<evget::Store>> evget::DatabaseManager::Snapshot(StoresHolder& holder) {
+evget::DatabaseManager::Reservation::Reservation(
+    std::shared_ptr<Usage> usage,
+    std::size_t n_entries,
+    std::size_t n_bytes
+)
+    : usage_{std::move(usage)}, n_entries_{n_entries}, n_bytes_{n_bytes} {}
+
+evget::DatabaseManager::Reservation::~Reservation() {
+    if (usage_ != nullptr) {
+        usage_->Release(n_entries_, n_bytes_);
+        usage_->Notify();
+    }
+}
+
+evget::DatabaseManager::StoreQueue::StoreQueue(std::shared_ptr<Store> store) : store{std::move(store)} {}
+
+std::vector<std::shared_ptr<evget::DatabaseManager::StoreQueue>>
+evget::DatabaseManager::Snapshot(StoresHolder& holder) {
     const std::scoped_lock lock{holder.lock};
     return holder.stores;
 }
 
+void evget::DatabaseManager::Flush(Buffer& buffer, StoresHolder& store_in, Scheduler& scheduler) {
+    const std::scoped_lock lock{buffer.drain_lock};
+    FlushLocked(buffer, store_in, scheduler);
+}
+
+void evget::DatabaseManager::FlushLocked(Buffer& buffer, StoresHolder& store_in, Scheduler& scheduler) {
+    auto queues = Snapshot(store_in);
+    if (!HasCapacity(queues)) {
+        // Leave the events in the ring until the slow store catches up. Clearing the flag lets the next event
+        // retry the flush.
+        buffer.drain_pending.store(false, std::memory_order_release);
+        spdlog::debug("store queue is full, deferring flush");
+        return;
+    }
+
+    // Batches are queued while holding the drain lock, so they reach every store in the order they were drained.
+    SpawnStoreData(DrainLocked(buffer), queues, scheduler);
+}
+
+bool evget::DatabaseManager::HasCapacity(const std::vector<std::shared_ptr<StoreQueue>>& store_in) {
+    return std::ranges::all_of(store_in, [](const auto& queue) {
+        const std::scoped_lock lock{queue->lock};
+        return queue->pending.size() < kMaxPendingBatches;
+    });
+}
+
+std::optional<evget::DatabaseManager::Batch> evget::DatabaseManager::DrainLocked(Buffer& buffer) {
+    // Clear the flag before popping so that events pushed during the drain can request another one.
+    buffer.drain_pending.store(false, std::memory_order_release);
+
+    std::vector<Data> drained{};
+    std::size_t n_entries = 0;
+    std::size_t n_bytes = 0;
+    while (auto data = buffer.ring.TryPop()) {
+        n_entries += data->Size();
+        n_bytes += data->Footprint();
+        drained.push_back(*std::move(data));
+    }
+
+    // The batch keeps the drained events counted against the limits until every store has written it.
+    buffer.buffered.Release(n_entries, n_bytes);
+    Reservation reservation{buffer.usage, n_entries, n_bytes};
+    if (n_entries == 0) {
+        return std::nullopt;
+    }
+
+    // The ring has space again, so wake a producer waiting for it, and start a new arena for the next window.
+    buffer.window.fetch_add(1, std::memory_order_relaxed);
+    buffer.usage->Notify();
+
+    // Reserve the whole window up front so that merging moves each entry once without regrowing the batch.
+    Data out{};
+    out.Reserve(n_entries);
+    for (auto& data : drained) {
+        out.MergeWith(std::move(data));
+    }
+
+    spdlog::debug("reached threshold, storing {} events", n_entries);
+    return Batch{
+        .data = std::move(out),
+        .reservation = std::move(reservation),
+        .drained_at = std::chrono::steady_clock::now(),
+    };
+}
+
+bool evget::DatabaseManager::ParkTimer(Buffer& buffer) {
+    if (buffer.buffered.entries.load() != 0) {
+        return false;
+    }
+
+    // An event pushed before the flag was set did not see it, so check again afterwards. If an event did arrive, take
+    // the flag back, unless the capture thread has already taken it and started a new timer.
+    buffer.timer_parked.store(true);
+    if (buffer.buffered.entries.load() == 0) {
+        return true;
+    }
+    return !buffer.timer_parked.exchange(false);
+}
+
+std::chrono::milliseconds evget::DatabaseManager::AdaptivePeriod(
+    std::chrono::milliseconds target,
+    const std::vector<std::shared_ptr<StoreQueue>>& store_in
+) {
+    std::chrono::microseconds latency{0};
+    for (const auto& queue : store_in) {
+        latency = std::max(latency, std::chrono::microseconds{queue->write_latency.load(std::memory_order_relaxed)});
+    }
+
+    // An event waits up to one period before it is drained and then for the write, so leave time for the slowest
+    // store within the target.
+    auto period = std::chrono::duration_cast<std::chrono::milliseconds>(target - latency);
+    return std::clamp(period, std::min(kMinStoreAfter, target), target);
+}
+
+bool evget::DatabaseManager::Fits(const Buffer& buffer, std::size_t n_entries, std::size_t n_bytes) {
+    const auto& usage = *buffer.usage;
+    auto entries = usage.entries.load(std::memory_order_acquire);
+    // An empty buffer always accepts events, so that one large event cannot block capture forever.
+    if (entries == 0) {
+        return true;
+    }
+
+    const auto& limits = buffer.limits;
+    if (limits.max_events != 0 && entries + n_entries > limits.max_events) {
+        return false;
+    }
+    return limits.max_bytes == 0 || usage.bytes.load(std::memory_order_acquire) + n_bytes <= limits.max_bytes;
+}
+
+bool evget::DatabaseManager::MakeRoom(Buffer& buffer) {
+    switch (buffer.limits.policy) {
+        case OverflowPolicy::kBlock:
+            return false;
+        case OverflowPolicy::kDropOldest:
+            return DropOldest(buffer);
+        case OverflowPolicy::kDropMouseMoves:
+            return RemoveMouseMoves(buffer, false) || DropOldest(buffer);
+        case OverflowPolicy::kCoalesceMoves:
+            return RemoveMouseMoves(buffer, true);
+    }
+    return false;
+}
+
+bool evget::DatabaseManager::DropOldest(Buffer& buffer) {
+    auto data = buffer.ring.TryPop();
+    if (!data.has_value()) {
+        return false;
+    }
+
+    buffer.Release(data->Size(), data->Footprint());
+    buffer.dropped.fetch_add(data->Size(), std::memory_order_relaxed);
+    buffer.window.fetch_add(1, std::memory_order_relaxed);
+    spdlog::debug("buffer is full, dropped {} oldest entries", data->Size());
+    return true;
+}
+
+bool evget::DatabaseManager::RemoveMouseMoves(Buffer& buffer, bool coalesce) {
+    std::vector<Data> drained{};
+    while (auto data = buffer.ring.TryPop()) {
+        drained.push_back(*std::move(data));
+    }
+
+    // Walk from the newest entry, so that when coalescing, a move is removed if the entry after it is also a move.
+    std::size_t removed = 0;
+    auto next_is_move = false;
+    for (auto& data : drained | std::views::reverse) {
+        auto n_entries = data.Size();
+        auto n_bytes = data.Footprint();
+        const auto& entries = data.Entries();
+
+        std::vector<bool> keep(entries.size());
+        for (auto i = entries.size(); i > 0; i--) {
+            auto is_move = entries.at(i - 1).Type() == EntryType::kMouseMove;
+            keep.at(i - 1) = !is_move || (coalesce && !next_is_move);
+            next_is_move = is_move;
+        }
+
+        // Remove in place, so that the kept entries stay in their arena.
+        data.EraseIf([&keep, i = std::size_t{0}](const Entry&) mutable { return !keep.at(i++); });
+
+        removed += n_entries - data.Size();
+        buffer.Release(n_entries, n_bytes);
+        buffer.Acquire(data.Size(), data.Footprint());
+    }
+
+    // Only the capture thread pushes, and it holds the drain lock, so everything that was popped fits again.
+    for (auto& data : drained) {
+        if (!data.Empty()) {
+            static_cast<void>(buffer.ring.TryPush(std::move(data)));
+        }
+    }
+
+    auto& counter = coalesce ? buffer.coalesced : buffer.dropped;
+    counter.fetch_add(removed, std::memory_order_relaxed);
+    if (removed != 0) {
+        buffer.window.fetch_add(1, std::memory_order_relaxed);
+        spdlog::debug("buffer is full, removed {} mouse moves", removed);
+    }
+    return removed != 0;
+}
+
 void evget::DatabaseManager::SpawnStoreData(
-    std::optional<std::vector<Data>> inner,
-    std::vector<std::shared_ptr<Store>> store_in,
+    std::optional<Batch> batch,
+    const std::vector<std::shared_ptr<StoreQueue>>& store_in,
     Scheduler& scheduler
 ) {
-    if (inner.has_value()) {
-        spdlog::info(std::format("reached threshold, storing {} events", inner->size()));
+    if (!batch.has_value()) {
+        return;
+    }
 
-        Data out{};
-        for (auto&& data : *std::move(inner)) {
-            out.MergeWith(std::move(data));
+    // Publish the batch once and queue it for every store. The last store to finish releases the batch.
+    auto shared = std::make_shared<const Batch>(*std::move(batch));
+    for (const auto& queue : store_in) {
+        const std::scoped_lock lock{queue->lock};
+        if (queue->failed) {
+            continue;
         }
+        queue->pending.push_back(shared);
 
-        scheduler.Spawn<Result<void>>(StoreCoroutine(out, std::move(store_in)), [&scheduler](Result<void> result) {
-            ResultHandler(std::move(result), scheduler);
-        });
+        // Start a worker for an idle store. A running worker picks up the batch after its current write.
+        if (!queue->writing) {
+            queue->writing = true;
+            scheduler.Spawn<Result<void>>(StoreCoroutine(queue), [store_in, &scheduler](Result<void> result) {
+                StoreResultHandler(std::move(result), store_in, scheduler);
+            });
+        }
     }
 }
 
 evget::Result<void> evget::DatabaseManager::StoreEvent(Data events) {
-    data_->PushBack(std::move(events));
+    auto n_entries = events.Size();
+    auto n_bytes = events.Footprint();
+    auto policy = data_->limits.policy;
+
+    while (true) {
+        auto fits = Fits(*data_, n_entries, n_bytes);
+        if (fits) {
+            // Count the events before publishing them, so that a drain never releases more than was acquired.
+            data_->Acquire(n_entries, n_bytes);
+            if (data_->ring.TryPush(std::move(events))) {
+                break;
+            }
+            data_->Release(n_entries, n_bytes);
+        }
+
+        // Only the slow path reads the generation. Space freed before the read is seen by the check before waiting.
+        auto generation = data_->usage->generation.load(std::memory_order_acquire);
+
+        // The ring is full or a limit is reached, so make room on this thread unless a consumer is already doing so.
+        {
+            const std::unique_lock lock{data_->drain_lock, std::try_to_lock};
+            if (lock.owns_lock()) {
+                // A full ring is drained without losing events, unless the store queues are full as well.
+                if (fits) {
+                    FlushLocked(*data_, *store_in_, *scheduler_);
+                }
+
+                auto full = !Fits(*data_, n_entries, n_bytes) || data_->ring.Size() >= data_->ring.Capacity();
+                if (full && !MakeRoom(*data_)) {
+                    if (policy == OverflowPolicy::kDropOldest || policy == OverflowPolicy::kDropMouseMoves) {
+                        // Everything left is already with the stores, so the new events are the only ones to drop.
+                        data_->dropped.fetch_add(n_entries, std::memory_order_relaxed);
+                        spdlog::debug("buffer is full, dropped {} new entries", n_entries);
+                        return {};
+                    }
+
+                    // Wait for the stores to catch up, flushing so that a limit below the threshold still drains.
+                    FlushLocked(*data_, *store_in_, *scheduler_);
+                }
+            }
+        }
+
+        if (scheduler_->IsStopped()) {
+            return Err{Error{
+                .error_type = ErrorType::kDatabaseManagerError,
+                .message = "scheduler stopped while waiting for space to store events"
+            }};
+        }
+
+        // Park until a drain frees ring space or a store releases a batch. The timeout covers space which is freed
+        // without a notification, such as a store queue emptying while its batch is still held by another store.
+        if (!Fits(*data_, n_entries, n_bytes) || data_->ring.Size() >= data_->ring.Capacity()) {
+            data_->usage->WaitForRelease(generation, kBlockedWait);
+        }
+    }
+
+    // Restart the timer if it stopped while nothing was buffered.
+    if (data_->timer_parked.load() && data_->timer_parked.exchange(false)) {
+        SpawnStoreAfter();
+    }
 
-    auto inner = data_->IntoInnerAt(n_events_);
-    SpawnStoreData(inner, Snapshot(*store_in_), *scheduler_);
+    // Thresholds count entries rather than calls, since one device event can produce several entries.
+    const auto& buffered = data_->buffered;
+    auto reached = buffered.entries.load(std::memory_order_acquire) >= n_events_ ||
+                   (n_bytes_ != 0 && buffered.bytes.load(std::memory_order_acquire) >= n_bytes_);
+    if (reached && !data_->drain_pending.exchange(true, std::memory_order_acq_rel)) {
+        // With a threshold of one event, spawning a coroutine for every flush costs more than draining the window,
+        // which is usually that one event, so drain it here. Larger windows are merged on the scheduler, and capture
+        // never waits on a consumer holding the lock.
+        std::unique_lock lock{data_->drain_lock, std::defer_lock};
+        if (n_events_ == 1 && lock.try_lock()) {
+            FlushLocked(*data_, *store_in_, *scheduler_);
+        } else {
+            auto& scheduler = *scheduler_;
+            scheduler.Spawn<Result<void>>(
+                StoreThresholdCoroutine(data_, store_in_, scheduler),
+                [&scheduler](Result<void> result) { ResultHandler(std::move(result), scheduler); }
+            );
+        }
+    }
 
     return {};
 }
 
+evget::Data evget::DatabaseManager::NewData() {
+    if (n_events_ <= 1) {
+        return Data{};
+    }
+
+    // Only the capture thread allocates from the arena. Stores release its data values on other threads, which a
+    // monotonic resource ignores, and the arena is destroyed by whichever thread drops the last reference to it.
+    auto window = data_->window.load(std::memory_order_relaxed);
+    if (arena_ == nullptr || window != arena_window_) {
+        arena_ = std::make_shared<std::pmr::monotonic_buffer_resource>(
+            std::min(n_events_ * kArenaFieldsPerEntry * sizeof(FieldValue), kMaxArenaBlock)
+        );
+        arena_window_ = window;
+    }
+    return Data{arena_};
+}
+
+evget::OverflowCounters evget::DatabaseManager::Overflow() const {
+    return {
+        .dropped = data_->dropped.load(std::memory_order_relaxed),
+        .coalesced = data_->coalesced.load(std::memory_order_relaxed),
+    };
+}
+
 void evget::DatabaseManager::AddStore(std::unique_ptr<Store> store) const {
     const std::scoped_lock lock{store_in_->lock};
-    store_in_->stores.emplace_back(std::move(store));
+    store_in_->stores.emplace_back(std::make_shared<StoreQueue>(std::move(store)));
 }
 
 boost::asio::awaitable<evget::Result<void>>
-evget::DatabaseManager::StoreCoroutine(Data data, std::vector<std::shared_ptr<Store>> store_in) {
-    for (const auto& store : store_in) {
-        auto result = store->StoreEvent(data);
+evget::DatabaseManager::StoreCoroutine(std::shared_ptr<StoreQueue> queue) {
+    while (true) {
+        std::vector<std::shared_ptr<const Batch>> group{};
+        {
+            const std::scoped_lock lock{queue->lock};
+            if (queue->pending.empty()) {
+                queue->writing = false;
+                co_return Result<void>{};
+            }
+
+            // Take everything queued so far and write it as one group.
+            group.assign(
+                std::make_move_iterator(queue->pending.begin()),
+                std::make_move_iterator(queue->pending.end())
+            );
+            queue->pending.clear();
+        }
+
+        std::vector<std::reference_wrapper<const Data>> batches{};
+        batches.reserve(group.size());
+        for (const auto& batch : group) {
+            batches.emplace_back(batch->data);
+        }
 
+        // Flush once per group, so that buffered outputs are written efficiently but never lag behind a write.
+        auto result = queue->store->StoreBatches(batches).and_then([&queue] { return queue->store->Flush(); });
         if (!result.has_value()) {
+            // Stop writing to this store only. Its queued batches are released so that they no longer count against
+            // the limits.
+            const std::scoped_lock lock{queue->lock};
+            queue->writing = false;
+            queue->failed = true;
+            queue->pending.clear();
             co_return result;
         }
+
+        // Batches are queued in order, so the first one in the group has waited the longest.
+        auto elapsed = std::chrono::steady_clock::now() - group.front()->drained_at;
+        auto latency = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+        auto previous = queue->write_latency.load(std::memory_order_relaxed);
+        queue->write_latency.store(
+            previous == 0 ? latency : ((previous * (kLatencySmoothing - 1)) + latency) / kLatencySmoothing,
+            std::memory_order_relaxed
+        );
     }
+}
 
+boost::asio::awaitable<evget::Result<void>> evget::DatabaseManager::StoreThresholdCoroutine(
+    std::shared_ptr<Buffer> data,
+    std::shared_ptr<StoresHolder> store_in,
+    Scheduler& scheduler
+) {
+    Flush(*data, *store_in, scheduler);
     co_return Result<void>{};
 }
 
 boost::asio::awaitable<std::expected<void, evget::Error<evget::ErrorType>>> evget::DatabaseManager::StoreAfterCoroutine(
     std::weak_ptr<Scheduler> scheduler_weak,
-    std::shared_ptr<LockingVector<Data>> data,
+    std::shared_ptr<Buffer> data,
     std::shared_ptr<StoresHolder> store_in,
-    std::chrono::seconds store_after
+    std::chrono::milliseconds store_after,
+    FlushTimer timer
 ) {
     auto store_interval = Interval{store_after};
     // Use a weak_ptr here to break cycle between scheduler and database manager, this must
@@ -104,20 +523,28 @@ boost::asio::awaitable<std::expected<void, evget::Error<evget::ErrorType>>> evge
 
         auto result = co_await store_interval.Tick();
 
-        spdlog::debug(std::format("timer threshold of {} seconds reached", store_interval.Period().count()));
+        spdlog::debug("timer threshold of {} ms reached", store_interval.Period().count());
 
         if (!result.has_value()) {
             co_return Err{Error{.error_type = ErrorType::kDatabaseManagerError, .message = result.error().message}};
         }
 
+        // Stop waking up while nothing is buffered.
+        if (ParkTimer(*data)) {
+            break;
+        }
+
         {
             auto scheduler = scheduler_weak.lock();
             if (!scheduler) {
                 break;
             }
 
-            auto data_inner = data->IntoInner();
-            SpawnStoreData(data_inner, Snapshot(*store_in), *scheduler);
+            Flush(*data, *store_in, *scheduler);
+        }
+
+        if (timer == FlushTimer::kAdaptive) {
+            store_interval.SetPeriod(AdaptivePeriod(store_after, Snapshot(*store_in)));
         }
     }
 
@@ -127,7 +554,7 @@ boost::asio::awaitable<std::expected<void, evget::Error<evget::ErrorType>>> evge
 void evget::DatabaseManager::SpawnStoreAfter() const {
     std::weak_ptr<Scheduler> weak_scheduler = scheduler_;
     scheduler_->Spawn<Result<void>>(
-        StoreAfterCoroutine(std::move(weak_scheduler), data_, store_in_, store_after_),
+        StoreAfterCoroutine(std::move(weak_scheduler), data_, store_in_, store_after_, timer_),
         [this](Result<void> result) { ResultHandler(std::move(result), *this->scheduler_); }
     );
 }
@@ -138,3 +565,23 @@ void evget::DatabaseManager::ResultHandler(Result<void> result, Scheduler& sched
         scheduler.Stop();
     }
 }
+
+void evget::DatabaseManager::StoreResultHandler(
+    Result<void> result,
+    const std::vector<std::shared_ptr<StoreQueue>>& store_in,
+    Scheduler& scheduler
+) {
+    if (result.has_value()) {
+        return;
+    }
+
+    spdlog::error("Error storing events, no more events are stored in this output: {}", result.error().message);
+    auto all_failed = std::ranges::all_of(store_in, [](const auto& queue) {
+        const std::scoped_lock lock{queue->lock};
+        return queue->failed;
+    });
+    if (all_failed) {
+        spdlog::error("Every output failed, stopping");
+        scheduler.Stop();
+    }
+}
@@ -1,14 +1,21 @@
 #include "evget/storage/database_storage.h"
 
-#include <boost/uuid/random_generator.hpp>
-#include <boost/uuid/uuid_io.hpp>
-
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <functional>
+#include <map>
 #include <memory>
-#include <optional>
 #include <ranges>
+#include <span>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "evget/database/connection.h"
@@ -17,180 +24,317 @@
 #include "evget/error.h"
 #include "evget/event/data.h"
 #include "evget/event/entry.h"
-#include "queries/insert_key.h"
-#include "queries/insert_key_modifier.h"
-#include "queries/insert_mouse_click.h"
-#include "queries/insert_mouse_click_modifier.h"
-#include "queries/insert_mouse_move.h"
-#include "queries/insert_mouse_move_modifier.h"
-#include "queries/insert_mouse_scroll.h"
-#include "queries/insert_mouse_scroll_modifier.h"
+#include "evget/event/interned_string.h"
+#include "evget/event/modifier_value.h"
+#include "evget/event/schema.h"
 #include "schema/initialize.h"
+#include "schema/integer_keys.h"
+#include "schema/integer_timestamps.h"
+#include "schema/modifier_bitmask.h"
+
+namespace {
+constexpr std::size_t kNEntryTypes = 4;
+constexpr std::size_t kNModifierColumns = 1;
+constexpr std::string_view kModifiersColumn = "modifiers";
+
+/**
+ * Split `n_rows` into chunks of at most `max_rows`, where every chunk size is a power of two, and call `insert` with
+ * the offset and size of each chunk. Keeping chunk sizes to powers of two bounds the number of distinct statements
+ * that need to be prepared per table.
+ */
+template <typename F>
+evget::Result<void> ForEachChunk(std::size_t n_rows, std::size_t max_rows, const F& insert) {
+    if (max_rows == 0) {
+        return evget::Err{{.error_type = evget::ErrorType::kDatabaseError, .message = "parameter limit is too small"}};
+    }
+
+    std::size_t offset = 0;
+    while (offset < n_rows) {
+        auto size = std::bit_floor(std::min(max_rows, n_rows - offset));
+
+        auto result = insert(offset, size);
+        if (!result.has_value()) {
+            return result;
+        }
+
+        offset += size;
+    }
+
+    return {};
+}
+
+/**
+ * Build a multi-row insert into `table` of `n_rows` rows, with one anonymous parameter for each field followed by
+ * one for the modifiers column.
+ */
+std::string BatchQuery(std::string_view table, std::span<const std::string_view> fields, std::size_t n_rows) {
+    std::string batch{"insert into "};
+    batch += table;
+    batch += " (";
+    for (const auto& field : fields) {
+        batch += field;
+        batch += ", ";
+    }
+    batch += kModifiersColumn;
+    batch += ") values ";
+
+    std::string row{"("};
+    for (std::size_t column = 0; column < fields.size() + kNModifierColumns; column++) {
+        row += column == 0 ? "?" : ", ?";
+    }
+    row += ")";
+
+    for (std::size_t index = 0; index < n_rows; index++) {
+        if (index != 0) {
+            batch += ", ";
+        }
+        batch += row;
+    }
+    batch += ";";
+
+    return batch;
+}
+} // namespace
 
 evget::DatabaseStorage::DatabaseStorage(std::unique_ptr<Connection> connection, std::filesystem::path database)
     : connection_{std::move(connection)}, database_{std::move(database)} {}
 
 evget::Result<void> evget::DatabaseStorage::StoreEvent(Data events) {
-    if (events.Empty()) {
+    return StoreBatch(events);
+}
+
+evget::Result<void> evget::DatabaseStorage::StoreBatch(const Data& events) {
+    const std::array batches{std::cref(events)};
+    return StoreBatches(batches);
+}
+
+evget::Result<void> evget::DatabaseStorage::StoreBatches(std::span<const std::reference_wrapper<const Data>> events) {
+    if (std::ranges::all_of(events, [](const Data& batch) { return batch.Empty(); })) {
         return {};
     }
 
-    return connection_->Connect(database_, ConnectOptions::kReadWriteCreate)
-        .and_then([this] { return connection_->Transaction(); })
-        .transform_error([](const Error<ErrorType>& error) {
-            return Error{.error_type = ErrorType::kDatabaseError, .message = error.message};
-        })
-        .and_then([this, &events] {
-            std::optional<std::unique_ptr<Query>> insert_key{};
-            std::optional<std::unique_ptr<Query>> insert_key_modifier{};
-            std::optional<std::unique_ptr<Query>> insert_mouse_move{};
-            std::optional<std::unique_ptr<Query>> insert_mouse_move_modifier{};
-            std::optional<std::unique_ptr<Query>> insert_mouse_click{};
-            std::optional<std::unique_ptr<Query>> insert_mouse_click_modifier{};
-            std::optional<std::unique_ptr<Query>> insert_mouse_scroll{};
-            std::optional<std::unique_ptr<Query>> insert_mouse_scroll_modifier{};
-
-            for (const auto& entry : events.Entries()) {
-                if (entry.Data().empty()) {
-                    continue;
-                }
-
-                Result<void> result;
-                switch (entry.Type()) {
-                    case EntryType::kKey:
-                        result = InsertEvents(
-                            entry,
-                            insert_key,
-                            insert_key_modifier,
-                            detail::insert_key,
-                            detail::insert_key_modifier
-                        );
-                        break;
-                    case EntryType::kMouseClick:
-                        result = InsertEvents(
-                            entry,
-                            insert_mouse_click,
-                            insert_mouse_click_modifier,
-                            detail::insert_mouse_click,
-                            detail::insert_mouse_click_modifier
-                        );
-                        break;
-                    case EntryType::kMouseMove:
-                        result = InsertEvents(
-                            entry,
-                            insert_mouse_move,
-                            insert_mouse_move_modifier,
-                            detail::insert_mouse_move,
-                            detail::insert_mouse_move_modifier
-                        );
-                        break;
-                    case EntryType::kMouseScroll:
-                        result = InsertEvents(
-                            entry,
-                            insert_mouse_scroll,
-                            insert_mouse_scroll_modifier,
-                            detail::insert_mouse_scroll,
-                            detail::insert_mouse_scroll_modifier
-                        );
-                        break;
-                }
-
-                if (!result.has_value()) {
-                    return result;
-                }
-            }
-
-            return this->connection_->Commit().transform_error([](const Error<ErrorType>& error) {
+    auto result = Connect().and_then([this, &events] {
+        return connection_->Transaction()
+            .transform_error([](const Error<ErrorType>& error) {
                 return Error{.error_type = ErrorType::kDatabaseError, .message = error.message};
+            })
+            .and_then([this, &events] {
+                return InsertEntries(events)
+                    .and_then([this] {
+                        return this->connection_->Commit().transform_error([](const Error<ErrorType>& error) {
+                            return Error{.error_type = ErrorType::kDatabaseError, .message = error.message};
+                        });
+                    })
+                    .or_else([this](const Error<ErrorType>& error) -> Result<void> {
+                        static_cast<void>(this->connection_->Rollback());
+                        return Err{error};
+                    });
             });
-        });
-}
+    });
 
-evget::Result<void> evget::DatabaseStorage::Init() const {
-    auto result = connection_->Connect(database_, ConnectOptions::kReadWriteCreate)
-                      .transform_error([](const Error<ErrorType>& error) {
-                          return Error{.error_type = ErrorType::kDatabaseError, .message = error.message};
-                      })
-                      .and_then([this] {
-                          auto migrations = std::vector{Migration{
-                              .version = 1,
-                              .description = "initialize database tables",
-                              .sql = detail::initialize,
-                              .exec = true,
-                          }};
-                          auto apply_migrations = Migrate{*this->connection_, migrations};
-
-                          return apply_migrations.ApplyMigrations().transform_error([](const Error<ErrorType>& error) {
-                              return Error{.error_type = ErrorType::kDatabaseError, .message = error.message};
-                          });
-                      });
+    if (!result.has_value()) {
+        // Start from a fresh connection and freshly prepared statements on the next call.
+        Disconnect();
+    }
 
     return result;
 }
 
-evget::Result<void> evget::DatabaseStorage::InsertEvents(
-    const Entry& entry,
-    std::optional<std::unique_ptr<Query>>& insert_statement,
-    std::optional<std::unique_ptr<Query>>& insert_modifier_statement,
-    std::string insert_query,
-    std::string insert_modifier_query
-) const {
-    SetOptionalStatement(insert_statement, std::move(insert_query));
-    SetOptionalStatement(insert_modifier_statement, std::move(insert_modifier_query));
+evget::Result<void> evget::DatabaseStorage::InsertEntries(std::span<const std::reference_wrapper<const Data>> events) {
+    auto max_parameters = connection_->MaxBindParameters();
+    if (!max_parameters.has_value()) {
+        return Err{{.error_type = ErrorType::kDatabaseError, .message = max_parameters.error().message}};
+    }
+
+    // Entries are grouped by type so that each table receives multi-row inserts. The relative order of
+    // entries within the same table is preserved.
+    std::array<std::vector<std::reference_wrapper<const Entry>>, kNEntryTypes> grouped{};
+    for (const Data& batch : events) {
+        for (const auto& entry : batch.Entries()) {
+            if (entry.Data().empty()) {
+                continue;
+            }
+
+            grouped.at(std::to_underlying(entry.Type())).emplace_back(entry);
+        }
+    }
 
-    auto entry_uuid = to_string(boost::uuids::random_generator()());
+    auto insert = [this, &grouped, &max_parameters](
+                      EntryType type,
+                      TableStatements& statements,
+                      const TableQueries& queries
+                  ) {
+        return InsertEvents(grouped.at(std::to_underlying(type)), statements, queries, *max_parameters);
+    };
 
-    // Optional is set in previous lines.
-    // NOLINTBEGIN(bugprone-unchecked-optional-access)
-    return BindValues(*insert_statement, entry.Data(), entry_uuid)
-        .and_then([&insert_modifier_statement, &entry, &entry_uuid] {
-            return BindValuesModifier(*insert_modifier_statement, entry.Modifiers(), entry_uuid);
+    return insert(
+               EntryType::kKey,
+               statements_.key,
+               {.table = "key", .fields = detail::kKeyFields}
+    )
+        .and_then([&insert, this] {
+            return insert(
+                EntryType::kMouseClick,
+                statements_.mouse_click,
+                {.table = "mouse_click", .fields = detail::kMouseClickFields}
+            );
+        })
+        .and_then([&insert, this] {
+            return insert(
+                EntryType::kMouseMove,
+                statements_.mouse_move,
+                {.table = "mouse_move", .fields = detail::kMouseMoveFields}
+            );
+        })
+        .and_then([&insert, this] {
+            return insert(
+                EntryType::kMouseScroll,
+                statements_.mouse_scroll,
+                {.table = "mouse_scroll", .fields = detail::kMouseScrollFields}
+            );
         });
-    // NOLINTEND(bugprone-unchecked-optional-access)
 }
 
-void evget::DatabaseStorage::SetOptionalStatement(
-    std::optional<std::unique_ptr<Query>>& query,
-    std::string query_string
-) const {
-    if (!query.has_value()) {
-        query = {connection_->BuildQuery(std::move(query_string))};
+evget::Result<void> evget::DatabaseStorage::Init() {
+    auto result = Connect().and_then([this] {
+        auto migrations = std::vector{
+            Migration{
+                .version = 1,
+                .description = "initialize database tables",
+                .sql = detail::initialize,
+                .exec = true,
+            },
+            Migration{
+                .version = 2,
+                .description = "use integer primary keys",
+                .sql = detail::integer_keys,
+                .exec = true,
+            },
+            Migration{
+                .version = 3,
+                .description = "store timestamps as integer microseconds",
+                .sql = detail::integer_timestamps,
+                .exec = true,
+            },
+            Migration{
+                .version = 4,
+                .description = "store modifiers as a bitmask",
+                .sql = detail::modifier_bitmask,
+                .exec = true,
+            },
+        };
+        auto apply_migrations = Migrate{*this->connection_, migrations};
+
+        return apply_migrations.ApplyMigrations().transform_error([](const Error<ErrorType>& error) {
+            return Error{.error_type = ErrorType::kDatabaseError, .message = error.message};
+        });
+    });
+
+    if (!result.has_value()) {
+        Disconnect();
     }
+
+    return result;
 }
 
-evget::Result<void> evget::DatabaseStorage::BindValues(
-    std::unique_ptr<Query>& query,
-    const std::vector<std::string>& data,
-    const std::string& entry_uuid
-) {
-    query->BindChars(0, entry_uuid.c_str());
-    for (const auto& [index, value] : std::views::enumerate(data)) {
-        query->BindChars(static_cast<int>(index) + 1, value.c_str());
+evget::Result<void> evget::DatabaseStorage::Connect() {
+    if (connected_) {
+        return {};
     }
 
-    return query->NextWhile().and_then(
-                                 [&query] { return (*query).Reset(); }
-    ).transform_error([](const Error<ErrorType>& error) {
-        return Error{.error_type = ErrorType::kDatabaseError, .message = error.message};
+    return connection_->Connect(database_, ConnectOptions::kReadWriteCreate)
+        .transform([this] { connected_ = true; })
+        .transform_error([](const Error<ErrorType>& error) {
+            return Error{.error_type = ErrorType::kDatabaseError, .message = error.message};
+        });
+}
+
+void evget::DatabaseStorage::Disconnect() {
+    // Prepared statements must be released before the connection they belong to is replaced.
+    statements_ = {};
+    connected_ = false;
+}
+
+evget::Result<void> evget::DatabaseStorage::InsertEvents(
+    std::span<const std::reference_wrapper<const Entry>> entries,
+    TableStatements& statements,
+    const TableQueries& queries,
+    std::size_t max_parameters
+) {
+    auto n_columns = queries.fields.size() + kNModifierColumns;
+    return ForEachChunk(entries.size(), max_parameters / n_columns, [&](std::size_t offset, std::size_t n_rows) {
+        return InsertChunk(entries.subspan(offset, n_rows), statements, queries);
     });
 }
 
-evget::Result<void> evget::DatabaseStorage::BindValuesModifier(
-    std::unique_ptr<Query>& query,
-    const std::vector<std::string>& modifiers,
-    const std::string& entry_uuid
+evget::Result<void> evget::DatabaseStorage::InsertChunk(
+    std::span<const std::reference_wrapper<const Entry>> entries,
+    TableStatements& statements,
+    const TableQueries& queries
 ) {
-    for (const auto& modifier : modifiers) {
-        auto modifier_uuid = boost::uuids::to_string(boost::uuids::random_generator()());
-        query->BindChars(0, modifier_uuid.c_str());
-        query->BindChars(1, entry_uuid.c_str());
-        query->BindChars(2, modifier.c_str());
+    auto n_columns = queries.fields.size() + kNModifierColumns;
+    auto& query = GetStatement(statements.insert, queries, entries.size());
+    for (const auto& [row, entry] : std::views::enumerate(entries)) {
+        const auto& data = entry.get().Data();
+        if (data.size() != queries.fields.size()) {
+            static_cast<void>(query.Reset());
+            return Err{{.error_type = ErrorType::kDatabaseError, .message = "entry has an unexpected number of fields"}
+            };
+        }
 
-        auto result = query->NextWhile().and_then([&query] { return (*query).Reset(); });
-        if (!result.has_value()) {
-            return Err{{.error_type = ErrorType::kDatabaseError, .message = result.error().message}};
+        auto position = static_cast<std::size_t>(row) * n_columns;
+        for (const auto& [index, value] : std::views::enumerate(data)) {
+            BindValue(query, static_cast<int>(position + index), value);
         }
+        // The modifiers are stored as a bitmask in the column after the data.
+        query.BindInt(static_cast<int>(position + queries.fields.size()), entry.get().Modifiers().Bits());
     }
 
-    return {};
+    return ExecuteStatement(query);
+}
+
+evget::Query& evget::DatabaseStorage::GetStatement(
+    std::map<std::size_t, std::unique_ptr<Query>>& statements,
+    const TableQueries& queries,
+    std::size_t n_rows
+) const {
+    auto& statement = statements[n_rows];
+    if (statement == nullptr) {
+        statement = connection_->BuildQuery(BatchQuery(queries.table, queries.fields, n_rows));
+    }
+
+    return *statement;
+}
+
+evget::Result<void> evget::DatabaseStorage::ExecuteStatement(Query& query) {
+    return query.NextWhile().and_then([&query] { return query.Reset(); }
+    ).transform_error([](const Error<ErrorType>& error) {
+        return Error{.error_type = ErrorType::kDatabaseError, .message = error.message};
+    });
+}
+
+void evget::DatabaseStorage::BindValue(Query& query, int position, const FieldValue& value) {
+    std::visit(
+        [&query, position](const auto& inner) {
+            using T = std::decay_t<decltype(inner)>;
+            if constexpr (std::is_same_v<T, std::monostate>) {
+                query.BindNull(position);
+            } else if constexpr (std::is_same_v<T, std::int64_t>) {
+                query.BindInt64(position, inner);
+            } else if constexpr (std::is_same_v<T, double>) {
+                query.BindDouble(position, inner);
+            } else if constexpr (std::is_same_v<T, InternedString>) {
+                query.BindStaticChars(position, inner.View().data());
+            } else if constexpr (std::is_same_v<T, std::string>) {
+                query.BindChars(position, inner.c_str());
+            } else if constexpr (std::is_same_v<T, IntervalType>) {
+                query.BindInt64(position, inner.count());
+            } else if constexpr (std::is_same_v<T, TimestampType>) {
+                query.BindInt64(position, ToEpochMicroseconds(inner));
+            } else {
+                query.BindInt(position, std::to_underlying(inner));
+            }
+        },
+        value
+    );
 }
@@ -0,0 +1,33 @@
+#include "evget/storage/fan_out_store.h"
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "evget/error.h"
+#include "evget/event/data.h"
+#include "evget/storage/store.h"
+
+evget::FanOutStore::FanOutStore(std::vector<std::reference_wrapper<Store>> inner) : inner_{std::move(inner)} {}
+
+evget::Result<void> evget::FanOutStore::StoreEvent(Data event) {
+    Result<void> result{};
+    for (std::size_t i = 0; i < inner_.size(); i++) {
+        // The last store can take the event, since no other store needs it after.
+        auto stored = i + 1 == inner_.size() ? inner_[i].get().StoreEvent(std::move(event))
+                                             : inner_[i].get().StoreEvent(event);
+        if (!stored.has_value() && result.has_value()) {
+            result = std::move(stored);
+        }
+    }
+
+    return result;
+}
+
+evget::Data evget::FanOutStore::NewData() {
+    if (inner_.empty()) {
+        return Data{};
+    }
+    return inner_.back().get().NewData();
+}
@@ -3,12 +3,12 @@
 #include <optional>
 #include <set>
 #include <utility>
+#include <variant>
 
 #include "evget/error.h"
 #include "evget/event/data.h"
 #include "evget/event/device_type.h"
 #include "evget/event/entry.h"
-#include "evget/event/schema.h"
 #include "evget/storage/store.h"
 
 evget::FilterStore::FilterStore(Store& inner, std::optional<std::set<DeviceType>> allowed)
@@ -19,22 +19,23 @@ evget::Result<void> evget::FilterStore::StoreEvent(Data event) {
         return inner_->StoreEvent(std::move(event));
     }
 
-    Data filtered{};
-    for (auto&& entry : std::move(event).IntoEntries()) {
+    // Filter in place, so that the entries stay in the memory the inner store created the data with.
+    event.EraseIf([this](const Entry& entry) {
         const auto& data = entry.Data();
         if (data.size() <= detail::kDeviceTypeIndex) {
-            filtered.AddEntry(std::move(entry));
-            continue;
+            return false;
         }
 
-        auto device = FromUnderlying<DeviceType>(data.at(detail::kDeviceTypeIndex));
-        if (!device.has_value() || allowed_->contains(*device)) {
-            filtered.AddEntry(std::move(entry));
-        }
-    }
+        const auto* device = std::get_if<DeviceType>(&data.at(detail::kDeviceTypeIndex));
+        return device != nullptr && !allowed_->contains(*device);
+    });
 
-    if (filtered.Empty()) {
+    if (event.Empty()) {
         return {};
     }
-    return inner_->StoreEvent(std::move(filtered));
+    return inner_->StoreEvent(std::move(event));
+}
+
+evget::Data evget::FilterStore::NewData() {
+    return inner_->NewData();
 }
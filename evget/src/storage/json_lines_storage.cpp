@@ -0,0 +1,48 @@
+#include "evget/storage/json_lines_storage.h"
+
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <utility>
+#include <variant>
+
+#include "evget/error.h"
+#include "evget/event/data.h"
+#include "evget/storage/json_writer.h"
+
+evget::Result<void> evget::JsonLinesStorage::StoreEvent(Data events) {
+    return StoreBatch(events);
+}
+
+evget::Result<void> evget::JsonLinesStorage::StoreBatch(const Data& events) {
+    if (events.Empty()) {
+        return Result<void>{};
+    }
+
+    std::visit(
+        [&events](auto& ostream) {
+            JsonWriter writer{*ostream, 0};
+            for (const auto& entry : events.Entries()) {
+                writer.WriteEntry(entry);
+                ostream->put('\n');
+            }
+        },
+        ostream_
+    );
+
+    return Result<void>{};
+}
+
+evget::Result<void> evget::JsonLinesStorage::Flush() {
+    auto failed = std::visit([](auto& ostream) { return ostream->flush().fail(); }, ostream_);
+    if (failed) {
+        return Err{{.error_type = ErrorType::kDatabaseError, .message = "failed to flush output stream"}};
+    }
+
+    return Result<void>{};
+}
+
+evget::JsonLinesStorage::JsonLinesStorage(std::unique_ptr<std::ostream> ostream) : ostream_{std::move(ostream)} {}
+
+evget::JsonLinesStorage::JsonLinesStorage(std::unique_ptr<std::ostream, std::function<void(std::ostream*)>> ostream)
+    : ostream_{std::move(ostream)} {}
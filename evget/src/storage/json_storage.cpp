@@ -1,50 +1,44 @@
 #include "evget/storage/json_storage.h"
 
-#include <nlohmann/json.hpp> // NOLINT(misc-include-cleaner)
-#include <nlohmann/json_fwd.hpp>
-
 #include <cstddef>
 #include <functional>
 #include <memory>
 #include <ostream>
 #include <utility>
 #include <variant>
-#include <vector>
 
 #include "evget/error.h"
 #include "evget/event/data.h"
-#include "evget/event/schema.h"
+#include "evget/storage/json_writer.h"
 
 evget::Result<void> evget::JsonStorage::StoreEvent(Data events) {
+    return StoreBatch(events);
+}
+
+evget::Result<void> evget::JsonStorage::StoreBatch(const Data& events) {
     if (events.Empty()) {
         return Result<void>{};
     }
 
-    auto formatted_entries = std::vector<nlohmann::json>{};
-    for (auto entry : events.Entries()) {
-        entry.ToNamedRepresentation();
-        auto entry_with_fields = entry.GetEntryWithFields();
-
-        auto formatted_fields = std::vector<nlohmann::json>{};
-        for (std::size_t i = 0; i < entry_with_fields.data.size(); i++) {
-            formatted_fields.push_back(
-                {{"name", entry_with_fields.fields.at(i)}, {"data", entry_with_fields.data.at(i)}}
-            );
-        }
-        formatted_entries.push_back(
-            {{"type", FromEntryType(entry_with_fields.type)},
-             {"fields", formatted_fields},
-             {"modifiers", entry_with_fields.modifiers}}
-        );
-    }
+    std::visit([this, &events](auto& ostream) { JsonWriter{*ostream, indent_}.WriteEntries(events); }, ostream_);
 
-    const nlohmann::json output{{"entries", formatted_entries}};
-    std::visit([output](auto&& ostream) { *ostream << output.dump(4) << "\n"; }, ostream_);
+    return Result<void>{};
+}
+
+evget::Result<void> evget::JsonStorage::Flush() {
+    auto failed = std::visit([](auto& ostream) { return ostream->flush().fail(); }, ostream_);
+    if (failed) {
+        return Err{{.error_type = ErrorType::kDatabaseError, .message = "failed to flush output stream"}};
+    }
 
     return Result<void>{};
 }
 
-evget::JsonStorage::JsonStorage(std::unique_ptr<std::ostream> ostream) : ostream_{std::move(ostream)} {}
+evget::JsonStorage::JsonStorage(std::unique_ptr<std::ostream> ostream, std::size_t indent)
+    : ostream_{std::move(ostream)}, indent_{indent} {}
 
-evget::JsonStorage::JsonStorage(std::unique_ptr<std::ostream, std::function<void(std::ostream*)>> ostream)
-    : ostream_{std::move(ostream)} {}
+evget::JsonStorage::JsonStorage(
+    std::unique_ptr<std::ostream, std::function<void(std::ostream*)>> ostream,
+    std::size_t indent
+)
+    : ostream_{std::move(ostream)}, indent_{indent} {}
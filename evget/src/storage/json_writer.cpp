@@ -0,0 +1,316 @@
+#include "evget/storage/json_writer.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <ios>
+#include <limits>
+#include <ostream>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+#include "evget/event/button_action.h"
+#include "evget/event/data.h"
+#include "evget/event/device_type.h"
+#include "evget/event/entry.h"
+#include "evget/event/interned_string.h"
+#include "evget/event/modifier_value.h"
+#include "evget/event/schema.h"
+
+namespace {
+constexpr std::string_view kHexDigits{"0123456789abcdef"};
+constexpr std::string_view kReplacementCharacter{"\\ufffd"};
+constexpr std::size_t kSpacesSize = 64;
+constexpr std::size_t kControlCharacterEnd = 0x20;
+constexpr std::size_t kAsciiEnd = 0x80;
+constexpr std::size_t kHexBase = 16;
+constexpr int kDoublePrecision = 6;
+// Large enough for any double in fixed notation, and for any integer or timestamp.
+constexpr std::size_t kNumberBufferSize = std::numeric_limits<double>::max_exponent10 + 32;
+
+/**
+ * The result of decoding one UTF-8 sequence.
+ */
+struct Utf8Sequence {
+    std::size_t length;
+    bool valid;
+};
+
+/**
+ * Decode the UTF-8 sequence that starts with a non-ASCII byte at `index`. Invalid sequences have the length of their
+ * longest prefix that could start a valid sequence, so that each one is replaced by a single replacement character.
+ */
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+Utf8Sequence DecodeUtf8(std::string_view value, std::size_t index) {
+    auto lead = static_cast<unsigned char>(value[index]);
+
+    // The number of continuation bytes, and the range of the first one, which excludes overlong encodings,
+    // surrogates and code points above U+10FFFF.
+    std::size_t n_continuation = 0;
+    unsigned char low = 0x80;
+    unsigned char high = 0xbf;
+    if (lead >= 0xc2 && lead <= 0xdf) {
+        n_continuation = 1;
+    } else if (lead == 0xe0) {
+        n_continuation = 2;
+        low = 0xa0;
+    } else if (lead == 0xed) {
+        n_continuation = 2;
+        high = 0x9f;
+    } else if (lead >= 0xe1 && lead <= 0xef) {
+        n_continuation = 2;
+    } else if (lead == 0xf0) {
+        n_continuation = 3;
+        low = 0x90;
+    } else if (lead >= 0xf1 && lead <= 0xf3) {
+        n_continuation = 3;
+    } else if (lead == 0xf4) {
+        n_continuation = 3;
+        high = 0x8f;
+    } else {
+        return {.length = 1, .valid = false};
+    }
+
+    for (std::size_t i = 1; i <= n_continuation; i++) {
+        if (index + i >= value.size()) {
+            return {.length = i, .valid = false};
+        }
+
+        auto continuation = static_cast<unsigned char>(value[index + i]);
+        if (continuation < low || continuation > high) {
+            return {.length = i, .valid = false};
+        }
+        low = 0x80;
+        high = 0xbf;
+    }
+
+    return {.length = n_continuation + 1, .valid = true};
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+} // namespace
+
+evget::JsonWriter::JsonWriter(std::ostream& ostream, std::size_t indent) : ostream_{ostream}, indent_{indent} {}
+
+void evget::JsonWriter::WriteEntries(const Data& data) {
+    BeginScope('{');
+    Newline();
+    WriteKey("entries");
+
+    BeginScope('[');
+    const auto& entries = data.Entries();
+    for (std::size_t i = 0; i < entries.size(); i++) {
+        if (i != 0) {
+            Separator();
+        }
+        Newline();
+        WriteEntry(entries[i]);
+    }
+    EndScope(']', entries.empty());
+
+    EndScope('}', false);
+    ostream_.put('\n');
+}
+
+void evget::JsonWriter::WriteEntry(const Entry& entry) {
+    BeginScope('{');
+    Newline();
+    WriteKey("type");
+    WriteString(FromEntryType(entry.Type()));
+    Separator();
+
+    Newline();
+    WriteKey("fields");
+    BeginScope('[');
+    const auto& data = entry.Data();
+    auto names = entry.FieldNames();
+    auto n_fields = std::min(data.size(), names.size());
+    for (std::size_t i = 0; i < n_fields; i++) {
+        if (i != 0) {
+            Separator();
+        }
+        Newline();
+
+        BeginScope('{');
+        Newline();
+        WriteKey("name");
+        WriteString(names[i]);
+        Separator();
+        Newline();
+        WriteKey("data");
+        WriteValue(data[i]);
+        EndScope('}', false);
+    }
+    EndScope(']', n_fields == 0);
+    Separator();
+
+    Newline();
+    WriteKey("modifiers");
+    BeginScope('[');
+    // Modifiers are carried as a bitmask and only expanded to their names here.
+    auto modifiers = entry.Modifiers();
+    for (auto [i, modifier] : std::views::enumerate(modifiers.Values())) {
+        if (i != 0) {
+            Separator();
+        }
+        Newline();
+        WriteString(FromModifierValue(modifier));
+    }
+    EndScope(']', modifiers.Empty());
+
+    EndScope('}', false);
+}
+
+void evget::JsonWriter::WriteString(std::string_view value) {
+    ostream_.put('"');
+
+    // Write runs of characters that do not need escaping in a single call.
+    std::size_t start = 0;
+    std::size_t i = 0;
+    while (i < value.size()) {
+        auto character = static_cast<unsigned char>(value[i]);
+        if (character >= kControlCharacterEnd && character < kAsciiEnd && character != '"' && character != '\\') {
+            i++;
+            continue;
+        }
+        if (character >= kAsciiEnd) {
+            auto sequence = DecodeUtf8(value, i);
+            if (sequence.valid) {
+                i += sequence.length;
+                continue;
+            }
+
+            // Invalid UTF-8 would make the output invalid JSON, so it is replaced.
+            ostream_.write(value.data() + start, static_cast<std::streamsize>(i - start));
+            ostream_ << kReplacementCharacter;
+            i += sequence.length;
+            start = i;
+            continue;
+        }
+
+        ostream_.write(value.data() + start, static_cast<std::streamsize>(i - start));
+        i++;
+        start = i;
+
+        switch (character) {
+            case '"':
+                ostream_ << "\\\"";
+                break;
+            case '\\':
+                ostream_ << "\\\\";
+                break;
+            case '\b':
+                ostream_ << "\\b";
+                break;
+            case '\f':
+                ostream_ << "\\f";
+                break;
+            case '\n':
+                ostream_ << "\\n";
+                break;
+            case '\r':
+                ostream_ << "\\r";
+                break;
+            case '\t':
+                ostream_ << "\\t";
+                break;
+            default:
+                ostream_ << "\\u00" << kHexDigits[character / kHexBase] << kHexDigits[character % kHexBase];
+                break;
+        }
+    }
+    ostream_.write(value.data() + start, static_cast<std::streamsize>(value.size() - start));
+
+    ostream_.put('"');
+}
+
+void evget::JsonWriter::WriteValue(const FieldValue& value) {
+    // Values are formatted the same way as `FromFieldValue`, but into a buffer on the stack rather than a string.
+    std::array<char, kNumberBufferSize> buffer{};
+    auto* first = buffer.data();
+    auto* last = buffer.data() + buffer.size();
+
+    std::visit(
+        [this, first, last](const auto& inner) {
+            using T = std::decay_t<decltype(inner)>;
+            if constexpr (std::is_same_v<T, std::monostate>) {
+                WriteString("");
+            } else if constexpr (std::is_same_v<T, std::int64_t>) {
+                WriteString({first, std::to_chars(first, last, inner).ptr});
+            } else if constexpr (std::is_same_v<T, double>) {
+                WriteString({first, std::to_chars(first, last, inner, std::chars_format::fixed, kDoublePrecision).ptr});
+            } else if constexpr (std::is_same_v<T, InternedString>) {
+                WriteString(inner.View());
+            } else if constexpr (std::is_same_v<T, std::string>) {
+                WriteString(inner);
+            } else if constexpr (std::is_same_v<T, IntervalType>) {
+                WriteString({first, std::to_chars(first, last, inner.count()).ptr});
+            } else if constexpr (std::is_same_v<T, TimestampType>) {
+                auto nanoseconds = std::chrono::time_point_cast<std::chrono::nanoseconds>(inner);
+                auto result = std::format_to_n(
+                    first,
+                    static_cast<std::ptrdiff_t>(last - first),
+                    "{:%Y-%m-%dT%H:%M:%S%z}",
+                    nanoseconds
+                );
+                WriteString({first, result.out});
+            } else if constexpr (std::is_same_v<T, DeviceType>) {
+                WriteString(FromDevice(inner));
+            } else {
+                WriteString(FromButtonAction(inner));
+            }
+        },
+        value
+    );
+}
+
+void evget::JsonWriter::WriteKey(std::string_view key) {
+    WriteString(key);
+    ostream_.put(':');
+    if (indent_ != 0) {
+        ostream_.put(' ');
+    }
+}
+
+void evget::JsonWriter::BeginScope(char open) {
+    ostream_.put(open);
+    depth_++;
+}
+
+void evget::JsonWriter::EndScope(char close, bool empty) {
+    depth_--;
+    if (!empty) {
+        Newline();
+    }
+    ostream_.put(close);
+}
+
+void evget::JsonWriter::Separator() {
+    ostream_.put(',');
+}
+
+void evget::JsonWriter::Newline() {
+    if (indent_ == 0) {
+        return;
+    }
+
+    static constexpr std::array<char, kSpacesSize> kSpaces = [] {
+        std::array<char, kSpacesSize> spaces{};
+        spaces.fill(' ');
+        return spaces;
+    }();
+
+    ostream_.put('\n');
+    auto remaining = depth_ * indent_;
+    while (remaining > 0) {
+        auto count = std::min(remaining, kSpaces.size());
+        ostream_.write(kSpaces.data(), static_cast<std::streamsize>(count));
+        remaining -= count;
+    }
+}
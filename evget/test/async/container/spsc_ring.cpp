@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <optional>
+#include <thread>
+#include <vector>
+
+// clang-format off
+#include "evget/async/container/spsc_ring.h"
+// clang-format on
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+TEST(SpscRingTest, CapacityRoundedToPowerOfTwo) {
+    ASSERT_EQ(evget::SpscRing<int>{5}.Capacity(), 8);
+    ASSERT_EQ(evget::SpscRing<int>{8}.Capacity(), 8);
+    ASSERT_EQ(evget::SpscRing<int>{0}.Capacity(), 1);
+}
+
+TEST(SpscRingTest, PushAndPopInOrder) {
+    auto ring = evget::SpscRing<int>{4};
+    ASSERT_TRUE(ring.TryPush(1));
+    ASSERT_TRUE(ring.TryPush(2));
+    ASSERT_EQ(ring.Size(), 2);
+
+    ASSERT_EQ(ring.TryPop(), 1);
+    ASSERT_EQ(ring.TryPop(), 2);
+    ASSERT_EQ(ring.TryPop(), std::nullopt);
+    ASSERT_EQ(ring.Size(), 0);
+}
+
+TEST(SpscRingTest, FullRingRejectsPushWithoutMoving) {
+    auto ring = evget::SpscRing<std::vector<int>>{2};
+    ASSERT_TRUE(ring.TryPush(std::vector{1}));
+    ASSERT_TRUE(ring.TryPush(std::vector{2}));
+
+    std::vector value{3};
+    ASSERT_FALSE(ring.TryPush(std::move(value)));
+    // NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved)
+    ASSERT_EQ(value, std::vector{3});
+
+    ASSERT_EQ(ring.TryPop(), std::vector{1});
+    ASSERT_TRUE(ring.TryPush(std::move(value)));
+    ASSERT_EQ(ring.TryPop(), std::vector{2});
+    ASSERT_EQ(ring.TryPop(), std::vector{3});
+}
+
+TEST(SpscRingTest, ConcurrentProducerAndConsumer) {
+    constexpr std::size_t kN = 100000;
+    auto ring = evget::SpscRing<std::size_t>{64};
+
+    std::thread producer{[&ring] {
+        for (std::size_t i = 0; i < kN; i++) {
+            auto value = i;
+            while (!ring.TryPush(std::move(value))) {
+                std::this_thread::yield();
+            }
+        }
+    }};
+
+    std::vector<std::size_t> popped{};
+    popped.reserve(kN);
+    while (popped.size() < kN) {
+        if (auto value = ring.TryPop()) {
+            popped.push_back(*value);
+        }
+    }
+    producer.join();
+
+    for (std::size_t i = 0; i < kN; i++) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+        ASSERT_EQ(popped[i], i);
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
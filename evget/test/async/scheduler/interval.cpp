@@ -2,6 +2,7 @@
 
 #include <boost/asio/awaitable.hpp>
 
+#include <chrono>
 #include <memory>
 
 #include "evget/async/scheduler/scheduler.h"
@@ -26,3 +27,25 @@ TEST(IntervalTest, Tick) {
 
     ASSERT_TRUE(result->has_value());
 }
+
+TEST(IntervalTest, SetPeriod) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    const auto interval = std::make_shared<evget::Interval>(std::chrono::milliseconds{10});
+    const auto result = std::make_shared<evget::Result<void>>();
+
+    auto start = std::chrono::steady_clock::now();
+    scheduler->Spawn(
+        [](std::shared_ptr<evget::Interval> interval,
+           std::shared_ptr<evget::Result<void>> result) -> boost::asio::awaitable<void> {
+            *result = co_await interval->Tick();
+            interval->SetPeriod(std::chrono::milliseconds{30});
+            *result = co_await interval->Tick();
+            co_return;
+        }(interval, result)
+    );
+    scheduler->Join();
+
+    ASSERT_TRUE(result->has_value());
+    ASSERT_EQ(interval->Period(), std::chrono::milliseconds{30});
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds{40});
+}
@@ -5,7 +5,9 @@
 #include <chrono>
 
 #include "common/args.h"
+#include "evget/database/sqlite/tuning.h"
 #include "evget/event/device_type.h"
+#include "evget/storage/buffer_limits.h"
 
 TEST(CliTest, GetStorageTypeJsonDefault) {
     EXPECT_EQ(evget::Cli::GetStorageType("-"), evget::StorageType::kJson);
@@ -22,6 +24,12 @@ TEST(CliTest, GetStorageTypeSqliteExtensions) {
     EXPECT_EQ(evget::Cli::GetStorageType("events.sl3"), evget::StorageType::kSqLite);
 }
 
+TEST(CliTest, GetStorageTypeJsonLinesExtensions) {
+    EXPECT_EQ(evget::Cli::GetStorageType("events.jsonl"), evget::StorageType::kJsonLines);
+    EXPECT_EQ(evget::Cli::GetStorageType("events.ndjson"), evget::StorageType::kJsonLines);
+    EXPECT_EQ(evget::Cli::GetStorageType("events.NDJSON"), evget::StorageType::kJsonLines);
+}
+
 TEST(CliTest, GetStorageTypeExtensionCaseInsensitive) {
     EXPECT_EQ(evget::Cli::GetStorageType("events.SQLITE"), evget::StorageType::kSqLite);
     EXPECT_EQ(evget::Cli::GetStorageType("events.Db"), evget::StorageType::kSqLite);
@@ -37,11 +45,20 @@ TEST(CliTest, ParseDefaults) {
     EXPECT_FALSE(*result);
     EXPECT_EQ(cli.EventSource(), evget::EventSource::kX11);
     EXPECT_EQ(cli.StoreNEvents(), 100U);
+    EXPECT_EQ(cli.StoreNBytes(), 0U);
     EXPECT_EQ(cli.StoreAfter(), std::chrono::seconds{100});
+    EXPECT_FALSE(cli.StoreAdaptive());
     EXPECT_FALSE(cli.Filter().has_value());
     EXPECT_FALSE(cli.Display().has_value());
     EXPECT_FALSE(cli.Seat().has_value());
     EXPECT_FALSE(cli.ScreenDimensions().has_value());
+    EXPECT_EQ(cli.SQLiteProfile(), evget::SQLiteProfile::kDefault);
+    EXPECT_EQ(cli.BufferLimits().max_events, 0U);
+    EXPECT_EQ(cli.BufferLimits().max_bytes, 0U);
+    EXPECT_EQ(cli.BufferLimits().policy, evget::OverflowPolicy::kBlock);
+    EXPECT_EQ(cli.Stream(), evget::StreamMode::kAuto);
+    EXPECT_TRUE(cli.IsStreamed("-"));
+    EXPECT_FALSE(cli.IsStreamed("store.json"));
 }
 
 TEST(CliTest, ParseFilterDeviceSet) {
@@ -103,3 +120,112 @@ TEST(CliTest, EventSourceMappingsIncludesWindows) {
     ASSERT_TRUE(cli.Parse(argv.Argc(), argv.Argv()).has_value());
     EXPECT_EQ(cli.EventSource(), evget::EventSource::kWindows);
 }
+
+TEST(CliTest, ParseSQLiteProfile) {
+    evget::Cli cli{evget::EventSource::kX11, false};
+    test::Args argv{{"evget", "--sqlite-profile", "Throughput"}};
+
+    ASSERT_TRUE(cli.Parse(argv.Argc(), argv.Argv()).has_value());
+    EXPECT_EQ(cli.SQLiteProfile(), evget::SQLiteProfile::kThroughput);
+}
+
+TEST(CliTest, ParseInvalidSQLiteProfile) {
+    evget::Cli cli{evget::EventSource::kX11, false};
+    test::Args argv{{"evget", "--sqlite-profile", "fast"}};
+
+    ASSERT_FALSE(cli.Parse(argv.Argc(), argv.Argv()).has_value());
+}
+
+TEST(CliTest, ParseStoreAfterUnits) {
+    evget::Cli milliseconds{evget::EventSource::kX11, false};
+    test::Args milliseconds_argv{{"evget", "--store-after", "100ms", "--store-adaptive"}};
+    ASSERT_TRUE(milliseconds.Parse(milliseconds_argv.Argc(), milliseconds_argv.Argv()).has_value());
+    EXPECT_EQ(milliseconds.StoreAfter(), std::chrono::milliseconds{100});
+    EXPECT_TRUE(milliseconds.StoreAdaptive());
+
+    evget::Cli seconds{evget::EventSource::kX11, false};
+    test::Args seconds_argv{{"evget", "--store-after", "2s"}};
+    ASSERT_TRUE(seconds.Parse(seconds_argv.Argc(), seconds_argv.Argv()).has_value());
+    EXPECT_EQ(seconds.StoreAfter(), std::chrono::seconds{2});
+
+    evget::Cli no_unit{evget::EventSource::kX11, false};
+    test::Args no_unit_argv{{"evget", "--store-after", "250"}};
+    ASSERT_TRUE(no_unit.Parse(no_unit_argv.Argc(), no_unit_argv.Argv()).has_value());
+    EXPECT_EQ(no_unit.StoreAfter(), std::chrono::milliseconds{250});
+}
+
+TEST(CliTest, ParseStoreAfterSeconds) {
+    evget::Cli cli{evget::EventSource::kX11, false};
+    test::Args argv{{"evget", "--store-after-seconds", "5"}};
+
+    ASSERT_TRUE(cli.Parse(argv.Argc(), argv.Argv()).has_value());
+    EXPECT_EQ(cli.StoreAfter(), std::chrono::seconds{5});
+}
+
+TEST(CliTest, ParseStoreAfterExcludesSeconds) {
+    evget::Cli cli{evget::EventSource::kX11, false};
+    test::Args argv{{"evget", "--store-after", "100ms", "--store-after-seconds", "5"}};
+
+    ASSERT_FALSE(cli.Parse(argv.Argc(), argv.Argv()).has_value());
+}
+
+TEST(CliTest, ParseStoreNBytes) {
+    evget::Cli cli{evget::EventSource::kX11, false};
+    test::Args argv{{"evget", "--store-n-bytes", "4KiB"}};
+
+    ASSERT_TRUE(cli.Parse(argv.Argc(), argv.Argv()).has_value());
+    EXPECT_EQ(cli.StoreNBytes(), 4096U);
+}
+
+TEST(CliTest, ParseBufferLimits) {
+    evget::Cli cli{evget::EventSource::kX11, false};
+    test::Args argv{
+        {"evget", "--buffer-events", "5000", "--buffer-bytes", "2MiB", "--overflow-policy", "Drop-Mouse-Moves"}
+    };
+
+    ASSERT_TRUE(cli.Parse(argv.Argc(), argv.Argv()).has_value());
+    EXPECT_EQ(cli.BufferLimits().max_events, 5000U);
+    EXPECT_EQ(cli.BufferLimits().max_bytes, 2U * 1024U * 1024U);
+    EXPECT_EQ(cli.BufferLimits().policy, evget::OverflowPolicy::kDropMouseMoves);
+}
+
+TEST(CliTest, ParseBufferLimitsDefault) {
+    evget::Cli cli{evget::EventSource::kX11, false};
+    test::Args argv{{"evget"}};
+
+    ASSERT_TRUE(cli.Parse(argv.Argc(), argv.Argv()).has_value());
+    EXPECT_EQ(cli.BufferLimits().max_events, 0U);
+    EXPECT_EQ(cli.BufferLimits().max_bytes, 0U);
+    EXPECT_EQ(cli.BufferLimits().policy, evget::OverflowPolicy::kBlock);
+}
+
+TEST(CliTest, ParseInvalidOverflowPolicy) {
+    evget::Cli cli{evget::EventSource::kX11, false};
+    test::Args argv{{"evget", "--overflow-policy", "drop-newest"}};
+
+    ASSERT_FALSE(cli.Parse(argv.Argc(), argv.Argv()).has_value());
+}
+
+TEST(CliTest, ParseStreamMode) {
+    evget::Cli all{evget::EventSource::kX11, false};
+    test::Args all_argv{{"evget", "--stream", "All"}};
+
+    ASSERT_TRUE(all.Parse(all_argv.Argc(), all_argv.Argv()).has_value());
+    EXPECT_EQ(all.Stream(), evget::StreamMode::kAll);
+    EXPECT_TRUE(all.IsStreamed("-"));
+    EXPECT_TRUE(all.IsStreamed("store.sqlite"));
+
+    evget::Cli none{evget::EventSource::kX11, false};
+    test::Args none_argv{{"evget", "--stream", "none"}};
+
+    ASSERT_TRUE(none.Parse(none_argv.Argc(), none_argv.Argv()).has_value());
+    EXPECT_EQ(none.Stream(), evget::StreamMode::kNone);
+    EXPECT_FALSE(none.IsStreamed("-"));
+}
+
+TEST(CliTest, ParseInvalidStreamMode) {
+    evget::Cli cli{evget::EventSource::kX11, false};
+    test::Args argv{{"evget", "--stream", "stdout"}};
+
+    ASSERT_FALSE(cli.Parse(argv.Argc(), argv.Argv()).has_value());
+}
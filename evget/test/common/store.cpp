@@ -3,8 +3,10 @@
 #include <chrono>
 #include <cstddef>
 #include <expected>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -13,6 +15,7 @@
 #include "evget/event/data.h"
 #include "evget/event/device_type.h"
 #include "evget/event/entry.h"
+#include "evget/event/interned_string.h"
 #include "evget/event/key.h"
 #include "evget/event/modifier_value.h"
 #include "evget/event/mouse_click.h"
@@ -50,7 +53,7 @@ evget::Data test::StoreMock::MakeKeyData(evget::DeviceType device) {
         .Timestamp(evget::TimestampType{})
         .PositionX(1)
         .PositionY(1)
-        .DeviceName("name")
+        .DeviceName(evget::InternedString{"name"})
         .FocusWindowName("name")
         .FocusWindowPositionX(1)
         .FocusWindowPositionY(1)
@@ -58,11 +61,11 @@ evget::Data test::StoreMock::MakeKeyData(evget::DeviceType device) {
         .FocusWindowHeight(1)
         .Screen(1)
         .Device(device)
-        .SystemEvent("test_event")
+        .SystemEvent(evget::InternedString{"test_event"})
         .Button(1)
-        .ButtonName("name")
+        .ButtonName(evget::InternedString{"name"})
         .Action(evget::ButtonAction::kPress)
-        .Character("a")
+        .Character(evget::InternedString{"a"})
         .Modifier(evget::ModifierValue::kAlt)
         .Build(data);
     return data;
@@ -75,7 +78,7 @@ evget::Data test::StoreMock::MakeMouseClickData(evget::DeviceType device) {
         .Timestamp(evget::TimestampType{})
         .PositionX(1)
         .PositionY(1)
-        .DeviceName("name")
+        .DeviceName(evget::InternedString{"name"})
         .FocusWindowName("name")
         .FocusWindowPositionX(1)
         .FocusWindowPositionY(1)
@@ -83,14 +86,123 @@ evget::Data test::StoreMock::MakeMouseClickData(evget::DeviceType device) {
         .FocusWindowHeight(1)
         .Screen(1)
         .Device(device)
-        .SystemEvent("test_event")
+        .SystemEvent(evget::InternedString{"test_event"})
         .Button(1)
-        .ButtonName("name")
+        .ButtonName(evget::InternedString{"name"})
         .Action(evget::ButtonAction::kPress)
         .Build(data);
     return data;
 }
 
+test::BatchRecorder::BatchRecorder(std::shared_ptr<StoreMock> wait_for) : wait_for_{std::move(wait_for)} {}
+
+evget::Result<void> test::BatchRecorder::StoreEvent(evget::Data event) {
+    return StoreBatch(event);
+}
+
+evget::Result<void> test::BatchRecorder::StoreBatch(const evget::Data& batch) {
+    std::size_t count = 0;
+    {
+        const std::scoped_lock guard{lock_};
+        count = batches_.size() + 1;
+    }
+
+    auto waited_for = true;
+    if (wait_for_ != nullptr) {
+        wait_for_->WaitForEvents(count);
+        waited_for = wait_for_->Events().size() >= count;
+    }
+
+    const std::scoped_lock guard{lock_};
+    batches_.push_back(&batch);
+    waited_for_ = waited_for_ && waited_for;
+    condition_.notify_all();
+    return {};
+}
+
+void test::BatchRecorder::WaitForBatches(std::size_t count) {
+    std::unique_lock guard{lock_};
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    condition_.wait_for(guard, std::chrono::seconds{5}, [&] { return batches_.size() >= count; });
+}
+
+std::vector<const evget::Data*> test::BatchRecorder::Batches() {
+    const std::scoped_lock guard{lock_};
+    return batches_;
+}
+
+bool test::BatchRecorder::WaitedFor() const {
+    const std::scoped_lock guard{lock_};
+    return waited_for_;
+}
+
+evget::Result<void> test::GatedStore::StoreEvent(evget::Data event) {
+    return StoreBatch(event);
+}
+
+evget::Result<void> test::GatedStore::StoreBatches(std::span<const std::reference_wrapper<const evget::Data>> batches) {
+    std::unique_lock guard{lock_};
+    overlapped_ = overlapped_ || writing_;
+    writing_ = true;
+    condition_.notify_all();
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    condition_.wait_for(guard, std::chrono::seconds{5}, [&] { return open_; });
+
+    groups_.push_back(batches.size());
+    for (const evget::Data& batch : batches) {
+        n_entries_ += batch.Size();
+        batches_.push_back(batch);
+    }
+    writing_ = false;
+    condition_.notify_all();
+    return {};
+}
+
+evget::Result<void> test::GatedStore::Flush() {
+    const std::scoped_lock guard{lock_};
+    // Record how many groups were written before each flush.
+    flushes_.push_back(groups_.size());
+    return {};
+}
+
+void test::GatedStore::WaitForWrite() {
+    std::unique_lock guard{lock_};
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    condition_.wait_for(guard, std::chrono::seconds{5}, [&] { return writing_; });
+}
+
+void test::GatedStore::Open() {
+    const std::scoped_lock guard{lock_};
+    open_ = true;
+    condition_.notify_all();
+}
+
+void test::GatedStore::WaitForEntries(std::size_t count) {
+    std::unique_lock guard{lock_};
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    condition_.wait_for(guard, std::chrono::seconds{5}, [&] { return n_entries_ >= count; });
+}
+
+std::vector<evget::Data> test::GatedStore::Batches() {
+    const std::scoped_lock guard{lock_};
+    return batches_;
+}
+
+std::vector<std::size_t> test::GatedStore::Groups() {
+    const std::scoped_lock guard{lock_};
+    return groups_;
+}
+
+std::vector<std::size_t> test::GatedStore::Flushes() {
+    const std::scoped_lock guard{lock_};
+    return flushes_;
+}
+
+bool test::GatedStore::Overlapped() const {
+    const std::scoped_lock guard{lock_};
+    return overlapped_;
+}
+
 evget::Result<void> test::StoreErrorMock::StoreEvent(evget::Data /*event*/) {
     return std::unexpected{
         evget::Error{.error_type = evget::ErrorType::kDatabaseManagerError, .message = "mock error"}
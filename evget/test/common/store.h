@@ -3,8 +3,10 @@
 
 #include <condition_variable>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <vector>
 
 #include "evget/error.h"
@@ -33,6 +35,57 @@ private:
     std::condition_variable condition_;
 };
 
+/**
+ * \brief A store that records the address of each shared batch it receives. If another store is given, each batch
+ *        is held until that store has received as many batches, or a timeout expires.
+ */
+class BatchRecorder : public evget::Store {
+public:
+    explicit BatchRecorder(std::shared_ptr<StoreMock> wait_for = nullptr);
+
+    evget::Result<void> StoreEvent(evget::Data event) override;
+    evget::Result<void> StoreBatch(const evget::Data& batch) override;
+    void WaitForBatches(std::size_t count);
+    std::vector<const evget::Data*> Batches();
+    [[nodiscard]] bool WaitedFor() const;
+
+private:
+    std::shared_ptr<StoreMock> wait_for_;
+    std::vector<const evget::Data*> batches_;
+    bool waited_for_{true};
+    mutable std::mutex lock_;
+    std::condition_variable condition_;
+};
+
+/**
+ * \brief A store that holds every write until it is opened, recording the groups of batches it receives, when it is
+ *        flushed, and whether two writes were ever in progress at the same time.
+ */
+class GatedStore : public evget::Store {
+public:
+    evget::Result<void> StoreEvent(evget::Data event) override;
+    evget::Result<void> StoreBatches(std::span<const std::reference_wrapper<const evget::Data>> batches) override;
+    evget::Result<void> Flush() override;
+    void WaitForWrite();
+    void Open();
+    void WaitForEntries(std::size_t count);
+    std::vector<evget::Data> Batches();
+    std::vector<std::size_t> Groups();
+    std::vector<std::size_t> Flushes();
+    [[nodiscard]] bool Overlapped() const;
+
+private:
+    std::vector<evget::Data> batches_;
+    std::vector<std::size_t> groups_;
+    std::vector<std::size_t> flushes_;
+    std::size_t n_entries_{0};
+    bool writing_{false};
+    bool open_{false};
+    bool overlapped_{false};
+    mutable std::mutex lock_;
+    std::condition_variable condition_;
+};
+
 /**
  * \brief Mock store that always returns an error.
  */
@@ -6,6 +6,7 @@
 // clang-format off
 #include "evget/database/sqlite/connection.h"
 // clang-format on
+#include "evget/database/sqlite/tuning.h"
 
 using DatabaseTest = test::DatabaseTest;
 
@@ -71,3 +72,48 @@ TEST_F(DatabaseTest, RollbackNoTransaction) {
 
     ASSERT_FALSE(rollback.has_value());
 }
+
+TEST_F(DatabaseTest, ConnectThroughputProfile) {
+    evget::SQLiteConnection connection{evget::SQLiteTuning::FromProfile(evget::SQLiteProfile::kThroughput)};
+
+    auto connect = connection.Connect(DatabaseFile(), evget::ConnectOptions::kReadWriteCreate);
+    ASSERT_TRUE(connect.has_value());
+
+    auto journal_mode = connection.BuildQuery("pragma journal_mode;");
+    ASSERT_TRUE(journal_mode->Next().value());
+    ASSERT_EQ(journal_mode->AsString(0).value(), "wal");
+
+    auto synchronous = connection.BuildQuery("pragma synchronous;");
+    ASSERT_TRUE(synchronous->Next().value());
+    ASSERT_EQ(synchronous->AsInt(0).value(), 1);
+
+    auto temp_store = connection.BuildQuery("pragma temp_store;");
+    ASSERT_TRUE(temp_store->Next().value());
+    ASSERT_EQ(temp_store->AsInt(0).value(), 2);
+}
+
+TEST_F(DatabaseTest, ConnectDurableProfile) {
+    evget::SQLiteConnection connection{evget::SQLiteTuning::FromProfile(evget::SQLiteProfile::kDurable)};
+
+    auto connect = connection.Connect(DatabaseFile(), evget::ConnectOptions::kReadWriteCreate);
+    ASSERT_TRUE(connect.has_value());
+
+    auto journal_mode = connection.BuildQuery("pragma journal_mode;");
+    ASSERT_TRUE(journal_mode->Next().value());
+    ASSERT_EQ(journal_mode->AsString(0).value(), "wal");
+
+    auto synchronous = connection.BuildQuery("pragma synchronous;");
+    ASSERT_TRUE(synchronous->Next().value());
+    ASSERT_EQ(synchronous->AsInt(0).value(), 2);
+}
+
+TEST_F(DatabaseTest, ConnectReadOnlySkipsJournalMode) {
+    evget::SQLiteConnection connection{evget::SQLiteTuning::FromProfile(evget::SQLiteProfile::kThroughput)};
+
+    auto connect = connection.Connect(DatabaseFile(), evget::ConnectOptions::kReadOnly);
+    ASSERT_TRUE(connect.has_value());
+
+    auto journal_mode = connection.BuildQuery("pragma journal_mode;");
+    ASSERT_TRUE(journal_mode->Next().value());
+    ASSERT_EQ(journal_mode->AsString(0).value(), "delete");
+}
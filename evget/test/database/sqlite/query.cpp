@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <format>
 
 #include "common/database.h"
@@ -121,6 +124,64 @@ TEST_F(DatabaseTest, BindChars) {
     ASSERT_EQ(result.value(), "1");
 }
 
+TEST_F(DatabaseTest, BindInt64) {
+    evget::SQLiteConnection connection{};
+
+    auto connect = connection.Connect(DatabaseFile(), evget::ConnectOptions::kReadWriteCreate);
+
+    auto select_query = connection.BuildQuery("select $1;");
+
+    select_query->BindInt64(0, std::int64_t{1} << 40);
+    ASSERT_TRUE(select_query->Next().value());
+
+    auto result = select_query->AsString(0);
+
+    ASSERT_EQ(result.value(), "1099511627776");
+}
+
+TEST_F(DatabaseTest, BindNull) {
+    evget::SQLiteConnection connection{};
+
+    auto connect = connection.Connect(DatabaseFile(), evget::ConnectOptions::kReadWriteCreate);
+
+    auto select_query = connection.BuildQuery("select typeof($1);");
+
+    select_query->BindNull(0);
+    ASSERT_TRUE(select_query->Next().value());
+
+    auto result = select_query->AsString(0);
+
+    ASSERT_EQ(result.value(), "null");
+}
+
+TEST_F(DatabaseTest, BindBlob) {
+    evget::SQLiteConnection connection{};
+
+    auto connect = connection.Connect(DatabaseFile(), evget::ConnectOptions::kReadWriteCreate);
+
+    auto select_query = connection.BuildQuery("select hex($1);");
+
+    const std::array value{std::byte{0x01}, std::byte{0xab}};
+    select_query->BindBlob(0, value);
+    ASSERT_TRUE(select_query->Next().value());
+
+    auto result = select_query->AsString(0);
+
+    ASSERT_EQ(result.value(), "01AB");
+}
+
+TEST_F(DatabaseTest, BindInvalidPosition) {
+    evget::SQLiteConnection connection{};
+
+    auto connect = connection.Connect(DatabaseFile(), evget::ConnectOptions::kReadWriteCreate);
+
+    auto select_query = connection.BuildQuery("select $1;");
+
+    select_query->BindInt(1, 1);
+
+    ASSERT_FALSE(select_query->Next().has_value());
+}
+
 TEST_F(DatabaseTest, AsBool) {
     evget::SQLiteConnection connection{};
 
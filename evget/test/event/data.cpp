@@ -1,20 +1,25 @@
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
 #include <string>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "evget/event/entry.h"
+#include "evget/event/modifier_value.h"
 // clang-format off
 #include "evget/event/data.h"
 // clang-format on
 
 TEST(DataTest, Create) {
     evget::Data data{};
-    data.AddEntry({evget::EntryType::kKey, {"data"}, {"modifier"}});
+    data.AddEntry({evget::EntryType::kKey, {"data"}, {evget::ModifierValue::kShift}});
 
     evget::Data merge{};
-    merge.AddEntry({evget::EntryType::kMouseMove, {"merge"}, {"merge_modifier"}});
+    merge.AddEntry({evget::EntryType::kMouseMove, {"merge"}, {evget::ModifierValue::kAlt}});
     data.MergeWith(std::move(merge));
 
     ASSERT_FALSE(data.Empty());
@@ -22,11 +27,76 @@ TEST(DataTest, Create) {
 
     auto first = data.Entries().at(0);
     ASSERT_EQ(first.Type(), evget::EntryType::kKey);
-    ASSERT_EQ(first.Data(), std::vector<std::string>{"data"});
-    ASSERT_EQ(first.Modifiers(), std::vector<std::string>{"modifier"});
+    ASSERT_EQ(first.Data(), std::pmr::vector<evget::FieldValue>{std::string{"data"}});
+    ASSERT_EQ(first.Modifiers(), evget::ModifierSet{evget::ModifierValue::kShift});
 
     auto second = data.Entries().at(1);
     ASSERT_EQ(second.Type(), evget::EntryType::kMouseMove);
-    ASSERT_EQ(second.Data(), std::vector<std::string>{"merge"});
-    ASSERT_EQ(second.Modifiers(), std::vector<std::string>{"merge_modifier"});
+    ASSERT_EQ(second.Data(), std::pmr::vector<evget::FieldValue>{std::string{"merge"}});
+    ASSERT_EQ(second.Modifiers(), evget::ModifierSet{evget::ModifierValue::kAlt});
+}
+
+TEST(DataTest, AllocatesFromArena) {
+    auto arena = std::make_shared<std::pmr::monotonic_buffer_resource>();
+    const std::weak_ptr<std::pmr::memory_resource> weak_arena{arena};
+
+    evget::Data data{arena};
+    data.AddEntry(evget::EntryType::kKey, {std::string{"data"}}, {evget::ModifierValue::kShift});
+    ASSERT_EQ(data.Entries().at(0).Data().get_allocator().resource(), arena.get());
+
+    // Copies do not refer to the arena of the original.
+    const evget::Data copy{data};
+    ASSERT_EQ(copy.Entries().at(0).Data().get_allocator().resource(), std::pmr::get_default_resource());
+    ASSERT_EQ(copy.Entries().at(0).Data(), std::pmr::vector<evget::FieldValue>{std::string{"data"}});
+
+    // Merged data keeps the arena alive without copying the entries.
+    evget::Data merged{};
+    merged.MergeWith(std::move(data));
+    arena.reset();
+    ASSERT_FALSE(weak_arena.expired());
+    ASSERT_EQ(merged.Entries().at(0).Data().get_allocator().resource(), weak_arena.lock().get());
+
+    auto entries = std::move(merged).IntoEntries();
+    ASSERT_EQ(entries.at(0).Data().get_allocator().resource(), std::pmr::get_default_resource());
+
+    merged = evget::Data{};
+    ASSERT_TRUE(weak_arena.expired());
+    ASSERT_EQ(entries.at(0).Modifiers(), evget::ModifierSet{evget::ModifierValue::kShift});
+}
+
+TEST(DataTest, EraseIf) {
+    auto arena = std::make_shared<std::pmr::monotonic_buffer_resource>();
+    evget::Data data{arena};
+    for (std::int64_t i = 0; i < 4; i++) {
+        data.AddEntry(evget::EntryType::kKey, {i}, {});
+    }
+
+    data.EraseIf([](const evget::Entry& entry) { return std::get<std::int64_t>(entry.Data().front()) % 2 == 0; });
+
+    ASSERT_EQ(data.Size(), 2);
+    ASSERT_EQ(data.Entries().at(0).Data().front(), evget::FieldValue{std::int64_t{1}});
+    ASSERT_EQ(data.Entries().at(1).Data().front(), evget::FieldValue{std::int64_t{3}});
+    ASSERT_EQ(data.Entries().at(1).Data().get_allocator().resource(), arena.get());
+}
+
+TEST(DataTest, Footprint) {
+    evget::Data data{};
+    ASSERT_EQ(data.Footprint(), 0);
+
+    data.Reserve(2);
+    data.AddEntry({evget::EntryType::kKey, {"first", "second"}, {}});
+    data.AddEntry({evget::EntryType::kKey, {"third"}, {}});
+
+    ASSERT_GE(data.Footprint(), (2 * sizeof(evget::Entry)) + (3 * sizeof(evget::FieldValue)));
+}
+
+TEST(DataTest, FootprintOwnedStrings) {
+    evget::Data small{};
+    small.AddEntry({evget::EntryType::kKey, {std::string{"name"}}, {}});
+
+    const std::string name(256, 'a');
+    evget::Data large{};
+    large.AddEntry({evget::EntryType::kKey, {name}, {}});
+
+    ASSERT_GE(large.Footprint(), small.Footprint() + name.size());
 }
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "evget/event/interned_string.h"
+
+TEST(InternedStringTest, EqualStringsShareId) {
+    const evget::InternedString first{"interned_string_test_equal"};
+    const evget::InternedString second{std::string{"interned_string_test_equal"}};
+
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(first.Id(), second.Id());
+    ASSERT_EQ(first.View().data(), second.View().data());
+    ASSERT_EQ(first.View(), "interned_string_test_equal");
+}
+
+TEST(InternedStringTest, DistinctStringsDiffer) {
+    const evget::InternedString first{"interned_string_test_first"};
+    const evget::InternedString second{"interned_string_test_second"};
+
+    ASSERT_NE(first, second);
+    ASSERT_NE(first.Id(), second.Id());
+}
+
+TEST(InternedStringTest, DefaultIsEmpty) {
+    const evget::InternedString empty{};
+
+    ASSERT_EQ(empty, evget::InternedString{""});
+    ASSERT_EQ(empty.Id(), 0);
+    ASSERT_TRUE(empty.View().empty());
+}
+
+TEST(InternedStringTest, CompareWithStringDoesNotIntern) {
+    const evget::InternedString first{"interned_string_test_compare"};
+
+    auto size = evget::StringPool::Global().Size();
+    ASSERT_EQ(first, "interned_string_test_compare");
+    ASSERT_NE(first, std::string_view{"interned_string_test_compare_other"});
+    ASSERT_EQ(evget::StringPool::Global().Size(), size);
+}
+
+TEST(InternedStringTest, ViewsRemainValid) {
+    const evget::InternedString first{"interned_string_test_stable"};
+    const auto* data = first.View().data();
+
+    auto size = evget::StringPool::Global().Size();
+    for (auto i = 0; i < 1000; i++) {
+        evget::InternedString{std::format("interned_string_test_grow_{}", i)};
+    }
+
+    ASSERT_EQ(evget::StringPool::Global().Size(), size + 1000);
+    ASSERT_EQ(first.View().data(), data);
+    ASSERT_EQ(first.View(), "interned_string_test_stable");
+    ASSERT_EQ(data[first.View().size()], '\0');
+}
+
+TEST(InternedStringTest, ConcurrentInterning) {
+    constexpr std::size_t kThreads = 4;
+    constexpr std::size_t kStrings = 100;
+
+    std::vector<std::vector<std::uint32_t>> ids(kThreads);
+    std::vector<std::thread> threads{};
+    for (std::size_t i = 0; i < kThreads; i++) {
+        threads.emplace_back([&ids, i] {
+            for (std::size_t j = 0; j < kStrings; j++) {
+                ids[i].push_back(evget::InternedString{std::format("interned_string_test_concurrent_{}", j)}.Id());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& thread_ids : ids) {
+        ASSERT_EQ(thread_ids, ids.front());
+    }
+}
@@ -0,0 +1,39 @@
+#include "evget/event/modifier_value.h"
+
+#include <gtest/gtest.h>
+
+#include <ranges>
+#include <vector>
+
+TEST(ModifierSetTest, Insert) {
+    evget::ModifierSet modifiers{};
+    ASSERT_TRUE(modifiers.Empty());
+
+    modifiers.Insert(evget::ModifierValue::kAlt).Insert(evget::ModifierValue::kShift);
+    modifiers.Insert(evget::ModifierValue::kAlt);
+
+    ASSERT_FALSE(modifiers.Empty());
+    ASSERT_EQ(modifiers.Size(), 2);
+    ASSERT_TRUE(modifiers.Contains(evget::ModifierValue::kShift));
+    ASSERT_TRUE(modifiers.Contains(evget::ModifierValue::kAlt));
+    ASSERT_FALSE(modifiers.Contains(evget::ModifierValue::kControl));
+    ASSERT_EQ(modifiers.Bits(), 0b1001);
+}
+
+TEST(ModifierSetTest, FromBits) {
+    auto modifiers = evget::ModifierSet::FromBits(0b10000100);
+
+    ASSERT_EQ(modifiers, (evget::ModifierSet{evget::ModifierValue::kControl, evget::ModifierValue::kMod5}));
+    ASSERT_NE(modifiers, evget::ModifierSet{evget::ModifierValue::kControl});
+}
+
+TEST(ModifierSetTest, Values) {
+    const evget::ModifierSet modifiers{evget::ModifierValue::kSuper, evget::ModifierValue::kShift};
+
+    auto values = modifiers.Values();
+    ASSERT_EQ(
+        (std::vector<evget::ModifierValue>{values.begin(), values.end()}),
+        (std::vector{evget::ModifierValue::kShift, evget::ModifierValue::kSuper})
+    );
+    ASSERT_TRUE(std::ranges::empty(evget::ModifierSet{}.Values()));
+}
@@ -6,6 +6,7 @@
 #include "evget/event/button_action.h"
 #include "evget/event/device_type.h"
 #include "evget/event/entry.h"
+#include "evget/event/interned_string.h"
 #include "evget/event/modifier_value.h"
 // clang-format off
 #include "evget/event/mouse_click.h"
@@ -19,7 +20,7 @@ TEST(MouseClickTest, Event) {
             .Timestamp(evget::TimestampType{})
             .PositionX(1)
             .PositionY(1)
-            .DeviceName("name")
+            .DeviceName(evget::InternedString{"name"})
             .FocusWindowName("name")
             .FocusWindowPositionX(1)
             .FocusWindowPositionY(1)
@@ -27,15 +28,14 @@ TEST(MouseClickTest, Event) {
             .FocusWindowHeight(1)
             .Screen(1)
             .Device(evget::DeviceType::kKeyboard)
-            .SystemEvent("test_event")
+            .SystemEvent(evget::InternedString{"test_event"})
             .Button(1)
-            .ButtonName("name")
+            .ButtonName(evget::InternedString{"name"})
             .Action(evget::ButtonAction::kPress)
             .Modifier(evget::ModifierValue::kAlt)
             .Build(data);
 
-    auto entry = mouse_click.Entries().at(0);
-    entry.ToNamedRepresentation();
+    const auto& entry = mouse_click.Entries().at(0);
     auto named_entry = entry.GetEntryWithFields();
 
     auto expected_fields =
@@ -5,6 +5,7 @@
 
 #include "evget/event/device_type.h"
 #include "evget/event/entry.h"
+#include "evget/event/interned_string.h"
 #include "evget/event/modifier_value.h"
 // clang-format off
 #include "evget/event/mouse_scroll.h"
@@ -18,7 +19,7 @@ TEST(MouseScrollTest, Event) {
             .Timestamp(evget::TimestampType{})
             .PositionX(1)
             .PositionY(1)
-            .DeviceName("name")
+            .DeviceName(evget::InternedString{"name"})
             .FocusWindowName("name")
             .FocusWindowPositionX(1)
             .FocusWindowPositionY(1)
@@ -26,14 +27,13 @@ TEST(MouseScrollTest, Event) {
             .FocusWindowHeight(1)
             .Screen(1)
             .Device(evget::DeviceType::kKeyboard)
-            .SystemEvent("test_event")
+            .SystemEvent(evget::InternedString{"test_event"})
             .Vertical(1)
             .Horizontal(1)
             .Modifier(evget::ModifierValue::kAlt)
             .Build(data);
 
-    auto entry = mouse_scroll.Entries().at(0);
-    entry.ToNamedRepresentation();
+    const auto& entry = mouse_scroll.Entries().at(0);
     auto named_entry = entry.GetEntryWithFields();
 
     auto expected_fields =
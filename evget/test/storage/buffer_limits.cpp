@@ -0,0 +1,31 @@
+#include "evget/storage/buffer_limits.h"
+
+#include <gtest/gtest.h>
+
+TEST(BufferLimitsTest, SplitEvenly) {
+    constexpr evget::BufferLimits limits{
+        .max_events = 1000,
+        .max_bytes = 4096,
+        .policy = evget::OverflowPolicy::kDropOldest
+    };
+
+    constexpr auto split = limits.Split(2);
+    ASSERT_EQ(split.max_events, 500);
+    ASSERT_EQ(split.max_bytes, 2048);
+    ASSERT_EQ(split.policy, evget::OverflowPolicy::kDropOldest);
+}
+
+TEST(BufferLimitsTest, SplitKeepsDisabledLimits) {
+    constexpr evget::BufferLimits limits{.max_events = 0, .max_bytes = 1};
+
+    constexpr auto split = limits.Split(2);
+    ASSERT_EQ(split.max_events, 0);
+    ASSERT_EQ(split.max_bytes, 1);
+}
+
+TEST(BufferLimitsTest, SplitSingleBuffer) {
+    constexpr evget::BufferLimits limits{.max_events = 3, .max_bytes = 5};
+
+    ASSERT_EQ(limits.Split(1).max_events, 3);
+    ASSERT_EQ(limits.Split(0).max_bytes, 5);
+}
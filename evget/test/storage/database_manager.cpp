@@ -2,27 +2,61 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
 #include <memory>
+#include <memory_resource>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "common/store.h"
 #include "evget/async/scheduler/scheduler.h"
+#include "evget/event/data.h"
+#include "evget/event/device_type.h"
+#include "evget/event/entry.h"
+#include "evget/storage/buffer_limits.h"
 
 // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
 
 namespace {
 
+using test::BatchRecorder;
+using test::GatedStore;
 using test::StoreErrorMock;
 using test::StoreForwarder;
 using test::StoreMock;
 
+evget::Data MakeEntry(evget::EntryType type, std::int64_t value) {
+    evget::Data data{};
+    data.AddEntry({type, {value}, {}});
+    return data;
+}
+
+std::vector<evget::FieldValue> Values(const std::vector<evget::Data>& batches) {
+    std::vector<evget::FieldValue> values{};
+    for (const auto& batch : batches) {
+        for (const auto& entry : batch.Entries()) {
+            values.push_back(entry.Data().front());
+        }
+    }
+    return values;
+}
+
+std::vector<evget::FieldValue> Values(std::initializer_list<std::int64_t> values) {
+    return {values.begin(), values.end()};
+}
+
 } // namespace
 
 TEST(DatabaseManagerTest, EventsBelowThresholdNotFlushed) {
     auto scheduler = std::make_shared<evget::Scheduler>();
     auto store = std::make_shared<StoreMock>();
 
-    evget::DatabaseManager manager{scheduler, {store}, 3, std::chrono::seconds{60}};
+    evget::DatabaseManager manager{scheduler, {store}, 3, 0, std::chrono::seconds{60}};
 
     ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
     ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
@@ -37,7 +71,7 @@ TEST(DatabaseManagerTest, EventsAtThresholdFlushed) {
     auto scheduler = std::make_shared<evget::Scheduler>();
     auto store = std::make_shared<StoreMock>();
 
-    evget::DatabaseManager manager{scheduler, {store}, 2, std::chrono::seconds{60}};
+    evget::DatabaseManager manager{scheduler, {store}, 2, 0, std::chrono::seconds{60}};
 
     ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
     ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
@@ -52,11 +86,98 @@ TEST(DatabaseManagerTest, EventsAtThresholdFlushed) {
     ASSERT_EQ(events[0].Entries().size(), 2);
 }
 
+TEST(DatabaseManagerTest, NewDataUsesWindowArena) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto store = std::make_shared<StoreMock>();
+
+    evget::DatabaseManager manager{scheduler, {store}, 2, 0, std::chrono::seconds{60}};
+
+    auto first = manager.NewData();
+    first.AddEntry(evget::EntryType::kKey, {std::int64_t{0}}, {});
+    auto second = manager.NewData();
+    second.AddEntry(evget::EntryType::kKey, {std::int64_t{1}}, {});
+
+    // Events in the same window share an arena.
+    auto* arena = first.Entries().front().Data().get_allocator().resource();
+    ASSERT_NE(arena, std::pmr::get_default_resource());
+    ASSERT_EQ(second.Entries().front().Data().get_allocator().resource(), arena);
+
+    // Hold on to the arena so that a new one cannot reuse its address.
+    auto held = manager.NewData();
+    ASSERT_TRUE(manager.StoreEvent(std::move(first)).has_value());
+    ASSERT_TRUE(manager.StoreEvent(std::move(second)).has_value());
+    store->WaitForEvents(1);
+
+    // The drain starts a new window with a new arena.
+    auto third = manager.NewData();
+    third.AddEntry(evget::EntryType::kKey, {std::int64_t{2}}, {});
+    ASSERT_NE(third.Entries().front().Data().get_allocator().resource(), arena);
+
+    scheduler->Stop();
+    scheduler->Join();
+
+    ASSERT_EQ(Values(store->Events()), Values({0, 1}));
+}
+
+TEST(DatabaseManagerTest, NewDataWithoutArenaForSingleEvents) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+
+    evget::DatabaseManager manager{scheduler, {}, 1, 0, std::chrono::seconds{60}};
+
+    auto data = manager.NewData();
+    data.AddEntry(evget::EntryType::kKey, {std::int64_t{0}}, {});
+    ASSERT_EQ(data.Entries().front().Data().get_allocator().resource(), std::pmr::get_default_resource());
+
+    scheduler->Stop();
+    scheduler->Join();
+}
+
+TEST(DatabaseManagerTest, ThresholdCountsEntries) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto store = std::make_shared<StoreMock>();
+
+    evget::DatabaseManager manager{scheduler, {store}, 3, 0, std::chrono::seconds{60}};
+
+    // One event which produces several entries reaches the threshold on its own.
+    auto data = StoreMock::MakeData();
+    data.MergeWith(StoreMock::MakeData());
+    data.MergeWith(StoreMock::MakeData());
+    ASSERT_TRUE(manager.StoreEvent(std::move(data)).has_value());
+
+    store->WaitForEvents(1);
+    scheduler->Stop();
+    scheduler->Join();
+
+    auto events = store->Events();
+    ASSERT_EQ(events.size(), 1);
+    ASSERT_EQ(events.front().Size(), 3);
+}
+
+TEST(DatabaseManagerTest, ByteThresholdFlushes) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto store = std::make_shared<StoreMock>();
+
+    // A copy is never larger than the original, so the second copy crosses the threshold but the first does not.
+    auto data = StoreMock::MakeKeyData(evget::DeviceType::kKeyboard);
+    evget::DatabaseManager manager{scheduler, {store}, 100, data.Footprint() + 1, std::chrono::seconds{60}};
+
+    ASSERT_TRUE(manager.StoreEvent(data).has_value());
+    ASSERT_TRUE(manager.StoreEvent(data).has_value());
+
+    store->WaitForEvents(1);
+    scheduler->Stop();
+    scheduler->Join();
+
+    auto events = store->Events();
+    ASSERT_EQ(events.size(), 1);
+    ASSERT_EQ(events.front().Size(), 2);
+}
+
 TEST(DatabaseManagerTest, MultipleEvents) {
     auto scheduler = std::make_shared<evget::Scheduler>();
     auto store = std::make_shared<StoreMock>();
 
-    evget::DatabaseManager manager{scheduler, {store}, 2, std::chrono::seconds{60}};
+    evget::DatabaseManager manager{scheduler, {store}, 2, 0, std::chrono::seconds{60}};
 
     ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
     ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
@@ -77,7 +198,7 @@ TEST(DatabaseManagerTest, MultipleStoresReceiveEvents) {
     auto store_one = std::make_shared<StoreMock>();
     auto store_two = std::make_shared<StoreMock>();
 
-    evget::DatabaseManager manager{scheduler, {store_one, store_two}, 1, std::chrono::seconds{60}};
+    evget::DatabaseManager manager{scheduler, {store_one, store_two}, 1, 0, std::chrono::seconds{60}};
 
     ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
 
@@ -90,12 +211,241 @@ TEST(DatabaseManagerTest, MultipleStoresReceiveEvents) {
     ASSERT_EQ(store_two->Events().size(), 1);
 }
 
+TEST(DatabaseManagerTest, StoresShareBatch) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto store_one = std::make_shared<BatchRecorder>();
+    auto store_two = std::make_shared<BatchRecorder>();
+
+    evget::DatabaseManager manager{scheduler, {store_one, store_two}, 1, 0, std::chrono::seconds{60}};
+
+    ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
+
+    store_one->WaitForBatches(1);
+    store_two->WaitForBatches(1);
+    scheduler->Stop();
+    scheduler->Join();
+
+    ASSERT_EQ(store_one->Batches().size(), 1);
+    ASSERT_EQ(store_two->Batches().size(), 1);
+    ASSERT_EQ(store_one->Batches().front(), store_two->Batches().front());
+}
+
+TEST(DatabaseManagerTest, StoresWrittenConcurrently) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto store_two = std::make_shared<StoreMock>();
+    // The first store only finishes once the second store has received the batch.
+    auto store_one = std::make_shared<BatchRecorder>(store_two);
+
+    evget::DatabaseManager manager{scheduler, {store_one, store_two}, 1, 0, std::chrono::seconds{60}};
+
+    ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
+
+    store_one->WaitForBatches(1);
+    scheduler->Stop();
+    scheduler->Join();
+
+    ASSERT_EQ(store_one->Batches().size(), 1);
+    ASSERT_TRUE(store_one->WaitedFor());
+}
+
+TEST(DatabaseManagerTest, QueuedBatchesStoredInOrder) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto store = std::make_shared<GatedStore>();
+
+    evget::DatabaseManager manager{scheduler, {store}, 1, 0, std::chrono::seconds{60}};
+
+    // The first batch holds the store, so the following batches queue up behind it.
+    ASSERT_TRUE(manager.StoreEvent(MakeEntry(evget::EntryType::kKey, 0)).has_value());
+    store->WaitForWrite();
+    for (std::int64_t i = 1; i < 4; i++) {
+        ASSERT_TRUE(manager.StoreEvent(MakeEntry(evget::EntryType::kKey, i)).has_value());
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    store->Open();
+
+    store->WaitForEntries(4);
+    scheduler->Stop();
+    scheduler->Join();
+
+    ASSERT_EQ(Values(store->Batches()), Values({0, 1, 2, 3}));
+    ASSERT_FALSE(store->Overlapped());
+
+    // The queued batches are written together after the first one.
+    auto groups = store->Groups();
+    ASSERT_EQ(groups.size(), 2);
+    ASSERT_EQ(groups.front(), 1);
+}
+
+TEST(DatabaseManagerTest, StoreFlushedAfterEachGroup) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto store = std::make_shared<GatedStore>();
+
+    evget::DatabaseManager manager{scheduler, {store}, 1, 0, std::chrono::seconds{60}};
+
+    ASSERT_TRUE(manager.StoreEvent(MakeEntry(evget::EntryType::kKey, 0)).has_value());
+    store->WaitForWrite();
+    for (std::int64_t i = 1; i < 4; i++) {
+        ASSERT_TRUE(manager.StoreEvent(MakeEntry(evget::EntryType::kKey, i)).has_value());
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    store->Open();
+
+    store->WaitForEntries(4);
+    scheduler->Stop();
+    scheduler->Join();
+
+    // Each group is flushed once, after it is written and before the next one starts.
+    auto groups = store->Groups();
+    auto flushes = store->Flushes();
+    ASSERT_EQ(flushes.size(), groups.size());
+    for (std::size_t i = 0; i < flushes.size(); i++) {
+        ASSERT_EQ(flushes[i], i + 1);
+    }
+}
+
+TEST(DatabaseManagerTest, BlockPolicyWaitsForStores) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto store = std::make_shared<GatedStore>();
+
+    evget::DatabaseManager manager{scheduler, {store}, 100, 0, std::chrono::seconds{1}, {.max_events = 2}};
+
+    std::atomic<bool> done{false};
+    std::thread producer{[&manager, &done] {
+        for (std::int64_t i = 0; i < 4; i++) {
+            ASSERT_TRUE(manager.StoreEvent(MakeEntry(evget::EntryType::kKey, i)).has_value());
+        }
+        done = true;
+    }};
+
+    // The first two events fill the buffer and are held by the store, so capture blocks.
+    store->WaitForWrite();
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    ASSERT_FALSE(done);
+    store->Open();
+    producer.join();
+
+    store->WaitForEntries(4);
+    scheduler->Stop();
+    scheduler->Join();
+
+    ASSERT_EQ(Values(store->Batches()), Values({0, 1, 2, 3}));
+    ASSERT_EQ(manager.Overflow().dropped, 0);
+}
+
+TEST(DatabaseManagerTest, BlockPolicyReturnsErrorWhenStopped) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto store = std::make_shared<GatedStore>();
+
+    evget::DatabaseManager manager{scheduler, {store}, 100, 0, std::chrono::seconds{1}, {.max_events = 2}};
+
+    std::atomic<bool> stored{true};
+    std::thread producer{[&manager, &stored] {
+        for (std::int64_t i = 0; i < 4 && stored; i++) {
+            stored = manager.StoreEvent(MakeEntry(evget::EntryType::kKey, i)).has_value();
+        }
+    }};
+
+    // Capture is blocked behind the held store, so stopping the scheduler releases it with an error.
+    store->WaitForWrite();
+    scheduler->Stop();
+    producer.join();
+    ASSERT_FALSE(stored);
+
+    store->Open();
+    scheduler->Join();
+}
+
+TEST(DatabaseManagerTest, DropOldestPolicy) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto store = std::make_shared<StoreMock>();
+
+    evget::DatabaseManager manager{
+        scheduler,
+        {store},
+        100,
+        0,
+        std::chrono::seconds{1},
+        {.max_events = 4, .policy = evget::OverflowPolicy::kDropOldest}
+    };
+
+    for (std::int64_t i = 0; i < 10; i++) {
+        ASSERT_TRUE(manager.StoreEvent(MakeEntry(evget::EntryType::kKey, i)).has_value());
+    }
+
+    store->WaitForEvents(1);
+    scheduler->Stop();
+    scheduler->Join();
+
+    ASSERT_EQ(Values(store->Events()), Values({6, 7, 8, 9}));
+    ASSERT_EQ(manager.Overflow().dropped, 6);
+}
+
+TEST(DatabaseManagerTest, DropMouseMovesPolicy) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto store = std::make_shared<StoreMock>();
+
+    evget::DatabaseManager manager{
+        scheduler,
+        {store},
+        100,
+        0,
+        std::chrono::seconds{1},
+        {.max_events = 4, .policy = evget::OverflowPolicy::kDropMouseMoves}
+    };
+
+    // Mouse moves are dropped before any key, and keys are only dropped once no mouse moves are left.
+    ASSERT_TRUE(manager.StoreEvent(MakeEntry(evget::EntryType::kMouseMove, 0)).has_value());
+    ASSERT_TRUE(manager.StoreEvent(MakeEntry(evget::EntryType::kKey, 1)).has_value());
+    ASSERT_TRUE(manager.StoreEvent(MakeEntry(evget::EntryType::kMouseMove, 2)).has_value());
+    ASSERT_TRUE(manager.StoreEvent(MakeEntry(evget::EntryType::kKey, 3)).has_value());
+    for (std::int64_t i = 4; i < 7; i++) {
+        ASSERT_TRUE(manager.StoreEvent(MakeEntry(evget::EntryType::kKey, i)).has_value());
+    }
+
+    store->WaitForEvents(1);
+    scheduler->Stop();
+    scheduler->Join();
+
+    ASSERT_EQ(Values(store->Events()), Values({3, 4, 5, 6}));
+    ASSERT_EQ(manager.Overflow().dropped, 3);
+}
+
+TEST(DatabaseManagerTest, CoalesceMovesPolicy) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto store = std::make_shared<StoreMock>();
+
+    evget::DatabaseManager manager{
+        scheduler,
+        {store},
+        100,
+        0,
+        std::chrono::seconds{1},
+        {.max_events = 4, .policy = evget::OverflowPolicy::kCoalesceMoves}
+    };
+
+    // Only the last of each run of mouse moves is kept.
+    ASSERT_TRUE(manager.StoreEvent(MakeEntry(evget::EntryType::kMouseMove, 0)).has_value());
+    ASSERT_TRUE(manager.StoreEvent(MakeEntry(evget::EntryType::kMouseMove, 1)).has_value());
+    ASSERT_TRUE(manager.StoreEvent(MakeEntry(evget::EntryType::kKey, 2)).has_value());
+    ASSERT_TRUE(manager.StoreEvent(MakeEntry(evget::EntryType::kMouseMove, 3)).has_value());
+    ASSERT_TRUE(manager.StoreEvent(MakeEntry(evget::EntryType::kMouseMove, 4)).has_value());
+    ASSERT_TRUE(manager.StoreEvent(MakeEntry(evget::EntryType::kMouseMove, 5)).has_value());
+
+    store->WaitForEvents(1);
+    scheduler->Stop();
+    scheduler->Join();
+
+    ASSERT_EQ(Values(store->Events()), Values({1, 2, 4, 5}));
+    ASSERT_EQ(manager.Overflow().coalesced, 2);
+    ASSERT_EQ(manager.Overflow().dropped, 0);
+}
+
 TEST(DatabaseManagerTest, AddStoreReceivesEvents) {
     auto scheduler = std::make_shared<evget::Scheduler>();
     auto constructor_store = std::make_shared<StoreMock>();
     auto added_store = std::make_shared<StoreMock>();
 
-    evget::DatabaseManager manager{scheduler, {constructor_store}, 1, std::chrono::seconds{60}};
+    evget::DatabaseManager manager{scheduler, {constructor_store}, 1, 0, std::chrono::seconds{60}};
     manager.AddStore(std::make_unique<StoreForwarder>(added_store));
 
     ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
@@ -114,7 +464,7 @@ TEST(DatabaseManagerTest, AddStoreVisibleToTimerFlush) {
     auto added_store = std::make_shared<StoreMock>();
 
     // High n_events ensures only the timer will flush.
-    evget::DatabaseManager manager{scheduler, {}, 100, std::chrono::seconds{1}};
+    evget::DatabaseManager manager{scheduler, {}, 100, 0, std::chrono::seconds{1}};
     manager.AddStore(std::make_unique<StoreForwarder>(added_store));
 
     ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
@@ -130,7 +480,7 @@ TEST(DatabaseManagerTest, TimerFlushesBelowThreshold) {
     auto scheduler = std::make_shared<evget::Scheduler>();
     auto store = std::make_shared<StoreMock>();
 
-    evget::DatabaseManager manager{scheduler, {store}, 100, std::chrono::seconds{1}};
+    evget::DatabaseManager manager{scheduler, {store}, 100, 0, std::chrono::seconds{1}};
 
     ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
 
@@ -141,22 +491,105 @@ TEST(DatabaseManagerTest, TimerFlushesBelowThreshold) {
     ASSERT_EQ(store->Events().size(), 1);
 }
 
+TEST(DatabaseManagerTest, SubSecondTimerFlush) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto store = std::make_shared<StoreMock>();
+
+    evget::DatabaseManager manager{scheduler, {store}, 100, 0, std::chrono::milliseconds{100}};
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
+
+    store->WaitForEvents(1);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    scheduler->Stop();
+    scheduler->Join();
+
+    ASSERT_EQ(store->Events().size(), 1);
+    ASSERT_LT(elapsed, std::chrono::seconds{1});
+}
+
+TEST(DatabaseManagerTest, TimerRestartsAfterIdle) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto store = std::make_shared<StoreMock>();
+
+    evget::DatabaseManager manager{scheduler, {store}, 100, 0, std::chrono::milliseconds{50}};
+
+    ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
+    store->WaitForEvents(1);
+
+    // The timer stops once it finds nothing buffered, and the next event starts it again.
+    std::this_thread::sleep_for(std::chrono::milliseconds{200});
+    ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
+
+    store->WaitForEvents(2);
+    scheduler->Stop();
+    scheduler->Join();
+
+    ASSERT_EQ(store->Events().size(), 2);
+}
+
+TEST(DatabaseManagerTest, AdaptiveTimerFlushes) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto store = std::make_shared<StoreMock>();
+
+    evget::DatabaseManager manager{
+        scheduler,
+        {store},
+        100,
+        0,
+        std::chrono::milliseconds{100},
+        {},
+        evget::FlushTimer::kAdaptive
+    };
+
+    // Keep the timer running across several ticks so that the period is adjusted.
+    for (std::size_t i = 0; i < 3; i++) {
+        ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
+        store->WaitForEvents(i + 1);
+    }
+
+    scheduler->Stop();
+    scheduler->Join();
+
+    ASSERT_EQ(store->Events().size(), 3);
+}
+
 TEST(DatabaseManagerTest, StoreErrorStopsScheduler) {
     auto scheduler = std::make_shared<evget::Scheduler>();
     auto store = std::make_shared<StoreErrorMock>();
 
-    evget::DatabaseManager manager{scheduler, {store}, 1, std::chrono::seconds{60}};
+    evget::DatabaseManager manager{scheduler, {store}, 1, 0, std::chrono::seconds{60}};
 
     ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
 
-    // The error handler calls scheduler->Stop()
+    // Every store failed, so the error handler calls scheduler->Stop()
     scheduler->Join();
 }
 
+TEST(DatabaseManagerTest, StoreErrorStopsOnlyThatStore) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto error_store = std::make_shared<StoreErrorMock>();
+    auto store = std::make_shared<StoreMock>();
+
+    evget::DatabaseManager manager{scheduler, {error_store, store}, 1, 0, std::chrono::seconds{60}};
+
+    ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
+    store->WaitForEvents(1);
+    ASSERT_TRUE(manager.StoreEvent(StoreMock::MakeData()).has_value());
+    store->WaitForEvents(2);
+
+    ASSERT_FALSE(scheduler->IsStopped());
+    scheduler->Stop();
+    scheduler->Join();
+
+    ASSERT_EQ(store->Events().size(), 2);
+}
+
 TEST(DatabaseManagerTest, StoreEventReturnsSuccess) {
     auto scheduler = std::make_shared<evget::Scheduler>();
 
-    evget::DatabaseManager manager{scheduler, {}, 5, std::chrono::seconds{60}};
+    evget::DatabaseManager manager{scheduler, {}, 5, 0, std::chrono::seconds{60}};
 
     auto result = manager.StoreEvent(StoreMock::MakeData());
     ASSERT_TRUE(result.has_value());
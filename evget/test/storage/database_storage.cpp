@@ -2,15 +2,20 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <chrono>
+#include <functional>
 #include <utility>
 
 #include "common/database.h"
+#include "common/store.h"
 #include "evget/database/connection.h"
 #include "evget/database/sqlite/connection.h"
 #include "evget/event/button_action.h"
 #include "evget/event/data.h"
 #include "evget/event/device_type.h"
 #include "evget/event/entry.h"
+#include "evget/event/interned_string.h"
 #include "evget/event/key.h"
 #include "evget/event/modifier_value.h"
 #include "evget/event/mouse_move.h"
@@ -50,20 +55,20 @@ TEST_F(DatabaseStorageTest, StoreKeyEvent) {
         .Timestamp(evget::TimestampType{})
         .PositionX(1.0)
         .PositionY(2.0)
-        .DeviceName("test_device")
+        .DeviceName(evget::InternedString{"test_device"})
         .FocusWindowName("test_window")
         .FocusWindowPositionX(3.0)
         .FocusWindowPositionY(4.0)
         .FocusWindowWidth(1920)
         .FocusWindowHeight(1080)
         .Screen(1)
-        .DeviceId("dev-1")
+        .DeviceId(evget::InternedString{"dev-1"})
         .Device(evget::DeviceType::kKeyboard)
-        .SystemEvent("test_event")
-        .EventSource("test_source")
+        .SystemEvent(evget::InternedString{"test_event"})
+        .EventSource(evget::InternedString{"test_source"})
         .Button(65)
-        .ButtonName("a")
-        .Character("a")
+        .ButtonName(evget::InternedString{"a"})
+        .Character(evget::InternedString{"a"})
         .Action(evget::ButtonAction::kPress)
         .Modifier(evget::ModifierValue::kAlt)
         .Build(data);
@@ -78,7 +83,7 @@ TEST_F(DatabaseStorageTest, StoreKeyEvent) {
     auto next = query->Next();
     ASSERT_TRUE(next.has_value());
 
-    ASSERT_EQ(query->AsDouble(1).value(), 100.0);
+    ASSERT_EQ(query->AsInt(1).value(), 100);
     ASSERT_EQ(query->AsDouble(3).value(), 1.0);
     ASSERT_EQ(query->AsDouble(4).value(), 2.0);
     ASSERT_EQ(query->AsString(5).value(), "test_device");
@@ -96,11 +101,7 @@ TEST_F(DatabaseStorageTest, StoreKeyEvent) {
     ASSERT_EQ(query->AsString(17).value(), "a");
     ASSERT_EQ(query->AsString(18).value(), "a");
     ASSERT_EQ(query->AsInt(19).value(), 0);
-
-    auto mod_query = connection.BuildQuery("select modifier_id from key_modifier;");
-    auto mod_next = mod_query->Next();
-    ASSERT_TRUE(mod_next.has_value());
-    ASSERT_EQ(mod_query->AsString(0).value(), "3");
+    ASSERT_EQ(query->AsInt(20).value(), 1 << 3); // kAlt
 }
 
 TEST_F(DatabaseStorageTest, StoreMouseMoveEvent) {
@@ -114,17 +115,17 @@ TEST_F(DatabaseStorageTest, StoreMouseMoveEvent) {
         .Timestamp(evget::TimestampType{})
         .PositionX(100.0)
         .PositionY(200.0)
-        .DeviceName("test_mouse")
+        .DeviceName(evget::InternedString{"test_mouse"})
         .FocusWindowName("window")
         .FocusWindowPositionX(5.0)
         .FocusWindowPositionY(6.0)
         .FocusWindowWidth(1920)
         .FocusWindowHeight(1080)
         .Screen(2)
-        .DeviceId("dev-2")
+        .DeviceId(evget::InternedString{"dev-2"})
         .Device(evget::DeviceType::kMouse)
-        .SystemEvent("move_event")
-        .EventSource("move_source")
+        .SystemEvent(evget::InternedString{"move_event"})
+        .EventSource(evget::InternedString{"move_source"})
         .TouchId(7)
         .Modifier(evget::ModifierValue::kShift)
         .Build(data);
@@ -139,7 +140,7 @@ TEST_F(DatabaseStorageTest, StoreMouseMoveEvent) {
     auto next = query->Next();
     ASSERT_TRUE(next.has_value());
 
-    ASSERT_EQ(query->AsDouble(1).value(), 200.0);
+    ASSERT_EQ(query->AsInt(1).value(), 200);
     ASSERT_EQ(query->AsDouble(3).value(), 100.0);
     ASSERT_EQ(query->AsDouble(4).value(), 200.0);
     ASSERT_EQ(query->AsString(5).value(), "test_mouse");
@@ -154,11 +155,60 @@ TEST_F(DatabaseStorageTest, StoreMouseMoveEvent) {
     ASSERT_EQ(query->AsString(14).value(), "move_source");
     ASSERT_EQ(query->AsInt(15).value(), 0);
     ASSERT_EQ(query->AsInt(16).value(), 7);
+    ASSERT_EQ(query->AsInt(17).value(), 1); // kShift
+}
 
-    auto mod_query = connection.BuildQuery("select modifier_id from mouse_move_modifier;");
-    auto mod_next = mod_query->Next();
-    ASSERT_TRUE(mod_next.has_value());
-    ASSERT_EQ(mod_query->AsString(0).value(), "0"); // kShift
+TEST_F(DatabaseStorageTest, StoreIntegerTimestamp) {
+    auto storage = MakeStorage();
+    auto init = storage.Init();
+    ASSERT_TRUE(init.has_value());
+
+    evget::Data data{};
+    evget::MouseMove{}
+        .Timestamp(evget::TimestampType{std::chrono::microseconds{1704164645123456}})
+        .Device(evget::DeviceType::kMouse)
+        .Build(data);
+
+    auto result = storage.StoreEvent(std::move(data));
+    ASSERT_TRUE(result.has_value());
+
+    evget::SQLiteConnection connection{};
+    auto connect = connection.Connect(DatabaseFile(), evget::ConnectOptions::kReadOnly);
+    ASSERT_TRUE(connect.has_value());
+
+    auto query = connection.BuildQuery("select typeof(timestamp), timestamp from mouse_move;");
+    ASSERT_TRUE(query->Next().value());
+    ASSERT_EQ(query->AsString(0).value(), "integer");
+    ASSERT_EQ(query->AsString(1).value(), "1704164645123456");
+
+    auto view_query = connection.BuildQuery("select timestamp from mouse_move_iso8601;");
+    ASSERT_TRUE(view_query->Next().value());
+    ASSERT_EQ(view_query->AsString(0).value(), "2024-01-02T03:04:05.123456Z");
+}
+
+TEST_F(DatabaseStorageTest, StoreIntegerInterval) {
+    auto storage = MakeStorage();
+    auto init = storage.Init();
+    ASSERT_TRUE(init.has_value());
+
+    evget::Data data{};
+    evget::MouseMove{}
+        .Interval(evget::IntervalType{1500})
+        .Timestamp(evget::TimestampType{})
+        .Device(evget::DeviceType::kMouse)
+        .Build(data);
+
+    auto result = storage.StoreEvent(std::move(data));
+    ASSERT_TRUE(result.has_value());
+
+    evget::SQLiteConnection connection{};
+    auto connect = connection.Connect(DatabaseFile(), evget::ConnectOptions::kReadOnly);
+    ASSERT_TRUE(connect.has_value());
+
+    auto query = connection.BuildQuery("select typeof(interval), interval from mouse_move;");
+    ASSERT_TRUE(query->Next().value());
+    ASSERT_EQ(query->AsString(0).value(), "integer");
+    ASSERT_EQ(query->AsString(1).value(), "1500");
 }
 
 TEST_F(DatabaseStorageTest, EmptyEntrySkipped) {
@@ -183,4 +233,158 @@ TEST_F(DatabaseStorageTest, EmptyEntrySkipped) {
     ASSERT_EQ(query->AsInt(0).value(), 0);
 }
 
+TEST_F(DatabaseStorageTest, StoreAcrossMultipleCalls) {
+    auto storage = MakeStorage();
+    auto init = storage.Init();
+    ASSERT_TRUE(init.has_value());
+
+    auto first = storage.StoreEvent(test::StoreMock::MakeKeyData(evget::DeviceType::kKeyboard));
+    ASSERT_TRUE(first.has_value());
+    auto second = storage.StoreEvent(test::StoreMock::MakeKeyData(evget::DeviceType::kKeyboard));
+    ASSERT_TRUE(second.has_value());
+
+    evget::SQLiteConnection connection{};
+    auto connect = connection.Connect(DatabaseFile(), evget::ConnectOptions::kReadOnly);
+    ASSERT_TRUE(connect.has_value());
+    auto query = connection.BuildQuery("select count(*) from key;");
+    auto next = query->Next();
+    ASSERT_TRUE(next.has_value());
+    ASSERT_EQ(query->AsInt(0).value(), 2);
+
+    auto mod_query = connection.BuildQuery("select count(*) from key where modifiers != 0;");
+    auto mod_next = mod_query->Next();
+    ASSERT_TRUE(mod_next.has_value());
+    ASSERT_EQ(mod_query->AsInt(0).value(), 2);
+}
+
+TEST_F(DatabaseStorageTest, ModifierNamesFromBitmask) {
+    auto storage = MakeStorage();
+    auto init = storage.Init();
+    ASSERT_TRUE(init.has_value());
+
+    auto first = storage.StoreEvent(test::StoreMock::MakeKeyData(evget::DeviceType::kKeyboard));
+    ASSERT_TRUE(first.has_value());
+    auto second = storage.StoreEvent(test::StoreMock::MakeKeyData(evget::DeviceType::kKeyboard));
+    ASSERT_TRUE(second.has_value());
+
+    evget::SQLiteConnection connection{};
+    auto connect = connection.Connect(DatabaseFile(), evget::ConnectOptions::kReadOnly);
+    ASSERT_TRUE(connect.has_value());
+    auto query = connection.BuildQuery(
+        "select key.id, modifier.value from key "
+        "join modifier on key.modifiers & (1 << modifier.id) != 0 order by key.id;"
+    );
+
+    ASSERT_TRUE(query->Next().value());
+    ASSERT_EQ(query->AsInt(0).value(), 1);
+    ASSERT_EQ(query->AsString(1).value(), "Alt");
+    ASSERT_TRUE(query->Next().value());
+    ASSERT_EQ(query->AsInt(0).value(), 2);
+    ASSERT_EQ(query->AsString(1).value(), "Alt");
+    ASSERT_FALSE(query->Next().value());
+}
+
+TEST_F(DatabaseStorageTest, StoreBatchedEvents) {
+    auto storage = MakeStorage();
+    auto init = storage.Init();
+    ASSERT_TRUE(init.has_value());
+
+    // Enough entries to span multiple chunks, interleaved with another entry type.
+    constexpr auto kNEntries = 5000;
+    evget::Data data{};
+    for (auto i = 0; i < kNEntries; i++) {
+        auto builder = evget::MouseMove{};
+        builder.Timestamp(evget::TimestampType{}).Device(evget::DeviceType::kMouse).TouchId(i);
+        if (i % 2 == 0) {
+            builder.Modifier(evget::ModifierValue::kShift);
+        }
+        if (i % 3 == 0) {
+            builder.Modifier(evget::ModifierValue::kAlt);
+        }
+        builder.Build(data);
+
+        if (i % 1000 == 0) {
+            data.MergeWith(test::StoreMock::MakeKeyData(evget::DeviceType::kKeyboard));
+        }
+    }
+
+    auto result = storage.StoreEvent(std::move(data));
+    ASSERT_TRUE(result.has_value());
+
+    evget::SQLiteConnection connection{};
+    auto connect = connection.Connect(DatabaseFile(), evget::ConnectOptions::kReadOnly);
+    ASSERT_TRUE(connect.has_value());
+
+    auto count = connection.BuildQuery("select count(*) from mouse_move;");
+    ASSERT_TRUE(count->Next().value());
+    ASSERT_EQ(count->AsInt(0).value(), kNEntries);
+
+    auto key_count = connection.BuildQuery("select count(*) from key;");
+    ASSERT_TRUE(key_count->Next().value());
+    ASSERT_EQ(key_count->AsInt(0).value(), 5);
+
+    // Rows keep their insertion order.
+    auto order = connection.BuildQuery("select count(*) from mouse_move where touch_id != id - 1;");
+    ASSERT_TRUE(order->Next().value());
+    ASSERT_EQ(order->AsInt(0).value(), 0);
+
+    auto modifier_count = connection.BuildQuery("select count(*) from mouse_move where modifiers != 0;");
+    ASSERT_TRUE(modifier_count->Next().value());
+    ASSERT_EQ(modifier_count->AsInt(0).value(), (kNEntries / 2) + (kNEntries / 3 + 1) - (kNEntries / 6 + 1));
+
+    // Every entry stores the modifiers it was built with.
+    auto mismatched = connection.BuildQuery(
+        "select count(*) from mouse_move where modifiers != "
+        "(case when touch_id % 2 = 0 then 1 else 0 end) | (case when touch_id % 3 = 0 then 8 else 0 end);"
+    );
+    ASSERT_TRUE(mismatched->Next().value());
+    ASSERT_EQ(mismatched->AsInt(0).value(), 0);
+}
+
+TEST_F(DatabaseStorageTest, StoreBatchesInOrder) {
+    auto storage = MakeStorage();
+    auto init = storage.Init();
+    ASSERT_TRUE(init.has_value());
+
+    evget::Data first{};
+    evget::Data second{};
+    for (auto i = 0; i < 10; i++) {
+        evget::MouseMove{}
+            .Timestamp(evget::TimestampType{})
+            .Device(evget::DeviceType::kMouse)
+            .TouchId(i)
+            .Build(i < 5 ? first : second);
+    }
+
+    const std::array batches{std::cref(first), std::cref(second)};
+    auto result = storage.StoreBatches(batches);
+    ASSERT_TRUE(result.has_value());
+
+    evget::SQLiteConnection connection{};
+    auto connect = connection.Connect(DatabaseFile(), evget::ConnectOptions::kReadOnly);
+    ASSERT_TRUE(connect.has_value());
+
+    auto count = connection.BuildQuery("select count(*) from mouse_move;");
+    ASSERT_TRUE(count->Next().value());
+    ASSERT_EQ(count->AsInt(0).value(), 10);
+
+    // Rows from later batches follow rows from earlier ones.
+    auto order = connection.BuildQuery("select count(*) from mouse_move where touch_id != id - 1;");
+    ASSERT_TRUE(order->Next().value());
+    ASSERT_EQ(order->AsInt(0).value(), 0);
+}
+
+TEST_F(DatabaseStorageTest, StoreWithoutInit) {
+    auto storage = MakeStorage();
+
+    // Tables do not exist, so the store fails and the connection is reset.
+    auto result = storage.StoreEvent(test::StoreMock::MakeKeyData(evget::DeviceType::kKeyboard));
+    ASSERT_FALSE(result.has_value());
+
+    auto init = storage.Init();
+    ASSERT_TRUE(init.has_value());
+    auto retry = storage.StoreEvent(test::StoreMock::MakeKeyData(evget::DeviceType::kKeyboard));
+    ASSERT_TRUE(retry.has_value());
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
@@ -0,0 +1,37 @@
+#include "evget/storage/fan_out_store.h"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <vector>
+
+#include "common/store.h"
+#include "evget/storage/store.h"
+
+TEST(FanOutStoreTest, ForwardsToAllStores) {
+    test::StoreMock first{};
+    test::StoreMock second{};
+    evget::FanOutStore fan_out{{first, second}};
+
+    ASSERT_TRUE(fan_out.StoreEvent(test::StoreMock::MakeData()).has_value());
+    ASSERT_TRUE(fan_out.StoreEvent(test::StoreMock::MakeData()).has_value());
+
+    ASSERT_EQ(first.Events().size(), 2);
+    ASSERT_EQ(second.Events().size(), 2);
+    ASSERT_EQ(first.Events().at(0).Size(), second.Events().at(0).Size());
+}
+
+TEST(FanOutStoreTest, ErrorStillForwardsToOtherStores) {
+    test::StoreErrorMock error{};
+    test::StoreMock inner{};
+    evget::FanOutStore fan_out{{error, inner}};
+
+    ASSERT_FALSE(fan_out.StoreEvent(test::StoreMock::MakeData()).has_value());
+    ASSERT_EQ(inner.Events().size(), 1);
+}
+
+TEST(FanOutStoreTest, NoStores) {
+    evget::FanOutStore fan_out{std::vector<std::reference_wrapper<evget::Store>>{}};
+
+    ASSERT_TRUE(fan_out.StoreEvent(test::StoreMock::MakeData()).has_value());
+}
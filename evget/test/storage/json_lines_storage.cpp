@@ -0,0 +1,102 @@
+#include "evget/storage/json_lines_storage.h"
+
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+#include <nlohmann/json_fwd.hpp>
+
+#include <functional>
+#include <ios>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "evget/event/data.h"
+#include "evget/event/entry.h"
+#include "evget/event/modifier_value.h"
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+TEST(JsonLinesStorageTest, EmptyDataNoOutput) {
+    std::ostringstream stream{};
+    evget::JsonLinesStorage storage{
+        std::unique_ptr<std::ostream, std::function<void(std::ostream*)>>{&stream, [](auto*) {}}
+    };
+
+    evget::Data data{};
+    auto result = storage.StoreEvent(std::move(data));
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_TRUE(stream.str().empty());
+}
+
+TEST(JsonLinesStorageTest, OneLinePerEntry) {
+    std::ostringstream stream{};
+    evget::JsonLinesStorage storage{
+        std::unique_ptr<std::ostream, std::function<void(std::ostream*)>>{&stream, [](auto*) {}}
+    };
+
+    evget::Data data{};
+    data.AddEntry({evget::EntryType::kKey, {"value1"}, {evget::ModifierValue::kShift}});
+    data.AddEntry({evget::EntryType::kMouseMove, {"value2"}, {}});
+
+    auto result = storage.StoreEvent(std::move(data));
+    ASSERT_TRUE(result.has_value());
+
+    std::istringstream lines{stream.str()};
+    std::string line{};
+
+    ASSERT_TRUE(std::getline(lines, line));
+    auto first = nlohmann::json::parse(line);
+    ASSERT_EQ(first["type"], "Key");
+    ASSERT_EQ(first["fields"][0]["data"], "value1");
+    ASSERT_EQ(first["modifiers"][0], "Shift");
+
+    ASSERT_TRUE(std::getline(lines, line));
+    auto second = nlohmann::json::parse(line);
+    ASSERT_EQ(second["type"], "MouseMove");
+
+    ASSERT_FALSE(std::getline(lines, line));
+}
+
+TEST(JsonLinesStorageTest, AppendsAcrossCalls) {
+    std::ostringstream stream{};
+    evget::JsonLinesStorage storage{
+        std::unique_ptr<std::ostream, std::function<void(std::ostream*)>>{&stream, [](auto*) {}}
+    };
+
+    evget::Data first{};
+    first.AddEntry({evget::EntryType::kKey, {"value1"}, {}});
+    ASSERT_TRUE(storage.StoreEvent(std::move(first)).has_value());
+
+    evget::Data second{};
+    second.AddEntry({evget::EntryType::kKey, {"value2"}, {}});
+    ASSERT_TRUE(storage.StoreEvent(std::move(second)).has_value());
+
+    std::istringstream lines{stream.str()};
+    std::string line{};
+    auto count = 0;
+    while (std::getline(lines, line)) {
+        ASSERT_EQ(nlohmann::json::parse(line)["type"], "Key");
+        count++;
+    }
+
+    ASSERT_EQ(count, 2);
+}
+
+TEST(JsonLinesStorageTest, FlushFailedStream) {
+    std::ostringstream stream{};
+    evget::JsonLinesStorage storage{
+        std::unique_ptr<std::ostream, std::function<void(std::ostream*)>>{&stream, [](auto*) {}}
+    };
+
+    ASSERT_TRUE(storage.Flush().has_value());
+
+    stream.setstate(std::ios_base::badbit);
+
+    ASSERT_FALSE(storage.Flush().has_value());
+}
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
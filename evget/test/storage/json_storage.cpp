@@ -6,13 +6,16 @@
 #include <nlohmann/json_fwd.hpp>
 
 #include <functional>
+#include <ios>
 #include <memory>
 #include <ostream>
 #include <sstream>
+#include <string>
 #include <utility>
 
 #include "evget/event/data.h"
 #include "evget/event/entry.h"
+#include "evget/event/modifier_value.h"
 
 // NOLINTBEGIN(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
 
@@ -72,7 +75,7 @@ TEST(JsonStorageTest, ModifiersIncluded) {
     };
 
     evget::Data data{};
-    data.AddEntry({evget::EntryType::kKey, {"value"}, {"0", "3"}});
+    data.AddEntry({evget::EntryType::kKey, {"value"}, {evget::ModifierValue::kShift, evget::ModifierValue::kAlt}});
 
     auto result = storage.StoreEvent(std::move(data));
 
@@ -84,4 +87,40 @@ TEST(JsonStorageTest, ModifiersIncluded) {
     ASSERT_EQ(modifiers[1], "Alt");
 }
 
+TEST(JsonStorageTest, CompactBatchPerLine) {
+    std::ostringstream stream{};
+    evget::JsonStorage storage{
+        std::unique_ptr<std::ostream, std::function<void(std::ostream*)>>{&stream, [](auto*) {}}, 0
+    };
+
+    evget::Data first{};
+    first.AddEntry({evget::EntryType::kKey, {"value1"}, {}});
+    first.AddEntry({evget::EntryType::kMouseMove, {"value2"}, {}});
+    ASSERT_TRUE(storage.StoreEvent(std::move(first)).has_value());
+
+    evget::Data second{};
+    second.AddEntry({evget::EntryType::kKey, {"value3"}, {}});
+    ASSERT_TRUE(storage.StoreEvent(std::move(second)).has_value());
+    ASSERT_TRUE(storage.Flush().has_value());
+
+    std::istringstream lines{stream.str()};
+    std::string line{};
+    std::getline(lines, line);
+    ASSERT_EQ(nlohmann::json::parse(line)["entries"].size(), 2);
+    std::getline(lines, line);
+    ASSERT_EQ(nlohmann::json::parse(line)["entries"].size(), 1);
+    ASSERT_FALSE(std::getline(lines, line));
+}
+
+TEST(JsonStorageTest, FlushFailedStream) {
+    std::ostringstream stream{};
+    evget::JsonStorage storage{
+        std::unique_ptr<std::ostream, std::function<void(std::ostream*)>>{&stream, [](auto*) {}}
+    };
+
+    stream.setstate(std::ios_base::badbit);
+
+    ASSERT_FALSE(storage.Flush().has_value());
+}
+
 // NOLINTEND(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
@@ -0,0 +1,120 @@
+#include "evget/storage/json_writer.h"
+
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+#include <nlohmann/json_fwd.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <sstream>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "evget/event/button_action.h"
+#include "evget/event/data.h"
+#include "evget/event/device_type.h"
+#include "evget/event/entry.h"
+#include "evget/event/interned_string.h"
+#include "evget/event/modifier_value.h"
+#include "evget/event/schema.h"
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+TEST(JsonWriterTest, WriteStringEscapes) {
+    std::ostringstream stream{};
+    evget::JsonWriter writer{stream, 0};
+
+    writer.WriteString("quote\" backslash\\ newline\n tab\t control\x01");
+
+    ASSERT_EQ(stream.str(), R"("quote\" backslash\\ newline\n tab\t control\u0001")");
+    ASSERT_EQ(nlohmann::json::parse(stream.str()), "quote\" backslash\\ newline\n tab\t control\x01");
+}
+
+TEST(JsonWriterTest, WriteStringReplacesInvalidUtf8) {
+    std::ostringstream stream{};
+    evget::JsonWriter writer{stream, 0};
+
+    writer.WriteString("valid \xc3\xa9 invalid \xff overlong \xc0\xaf truncated \xe2\x82");
+
+    ASSERT_EQ(stream.str(), "\"valid \xc3\xa9 invalid \\ufffd overlong \\ufffd\\ufffd truncated \\ufffd\"");
+    ASSERT_EQ(
+        nlohmann::json::parse(stream.str()),
+        "valid \xc3\xa9 invalid \xef\xbf\xbd overlong \xef\xbf\xbd\xef\xbf\xbd truncated \xef\xbf\xbd"
+    );
+}
+
+TEST(JsonWriterTest, WriteValuesFormattedAsFieldValues) {
+    std::ostringstream stream{};
+    evget::JsonWriter writer{stream, 0};
+
+    std::pmr::vector<evget::FieldValue> values{
+        std::int64_t{-42},
+        2.5,
+        evget::InternedString{"device"},
+        std::string{"window"},
+        evget::IntervalType{1500},
+        evget::TimestampType{std::chrono::microseconds{1704164645123456}},
+        evget::DeviceType::kTouchscreen,
+        evget::ButtonAction::kRelease,
+    };
+    const evget::Entry entry{evget::EntryType::kMouseMove, values, {}};
+    writer.WriteEntry(entry);
+
+    auto json = nlohmann::json::parse(stream.str());
+    ASSERT_EQ(json["fields"].size(), values.size());
+    for (std::size_t i = 0; i < values.size(); i++) {
+        ASSERT_EQ(json["fields"][i]["data"], evget::FromFieldValue(values[i]));
+    }
+}
+
+TEST(JsonWriterTest, WriteEntryCompact) {
+    std::ostringstream stream{};
+    evget::JsonWriter writer{stream, 0};
+
+    const evget::Entry entry{
+        evget::EntryType::kMouseMove,
+        {std::monostate{}, std::int64_t{1}, 2.0, std::string{"name"}},
+        {evget::ModifierValue::kShift}
+    };
+    writer.WriteEntry(entry);
+
+    ASSERT_EQ(stream.str().find('\n'), std::string::npos);
+    ASSERT_EQ(stream.str().find(' '), std::string::npos);
+
+    auto json = nlohmann::json::parse(stream.str());
+    ASSERT_EQ(json["type"], "MouseMove");
+    ASSERT_EQ(json["fields"].size(), 4);
+    ASSERT_EQ(json["fields"][0]["name"], "interval");
+    ASSERT_EQ(json["fields"][0]["data"], "");
+    ASSERT_EQ(json["fields"][1]["name"], "timestamp");
+    ASSERT_EQ(json["fields"][1]["data"], "1");
+    ASSERT_EQ(json["fields"][3]["name"], "position_y");
+    ASSERT_EQ(json["fields"][3]["data"], "name");
+    ASSERT_EQ(json["modifiers"], nlohmann::json::array({"Shift"}));
+}
+
+TEST(JsonWriterTest, WriteEntriesIndented) {
+    std::ostringstream stream{};
+    evget::JsonWriter writer{stream, 4};
+
+    evget::Data data{};
+    data.AddEntry({evget::EntryType::kKey, {}, {}});
+    data.AddEntry({evget::EntryType::kMouseClick, {evget::DeviceType::kMouse}, {}});
+    writer.WriteEntries(data);
+
+    ASSERT_TRUE(stream.str().starts_with("{\n    \"entries\": [\n        {\n"));
+    ASSERT_TRUE(stream.str().ends_with("}\n"));
+
+    auto json = nlohmann::json::parse(stream.str());
+    ASSERT_EQ(json["entries"].size(), 2);
+    ASSERT_EQ(json["entries"][0]["type"], "Key");
+    ASSERT_TRUE(json["entries"][0]["fields"].empty());
+    ASSERT_TRUE(json["entries"][0]["modifiers"].empty());
+    ASSERT_EQ(json["entries"][1]["fields"][0]["data"], "Mouse");
+}
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
@@ -53,9 +53,9 @@ private:
     struct EventContext {
         evget::TimestampType timestamp;
         evget::DeviceType device_type;
-        const char* device_name;
-        std::reference_wrapper<const std::string> device_uuid;
-        std::string system_event;
+        evget::InternedString device_name;
+        evget::InternedString device_uuid;
+        evget::InternedString system_event;
     };
 
     std::reference_wrapper<LibInputApi> libinput_api_;
@@ -64,11 +64,13 @@ private:
 
     evget::DeviceId<libinput_device*> device_ids_;
 
-    std::unordered_map<std::string, double> previous_absolute_x_;
-    std::unordered_map<std::string, double> previous_absolute_y_;
-    std::map<std::pair<std::string, std::int32_t>, double> previous_touch_x_;
-    std::map<std::pair<std::string, std::int32_t>, double> previous_touch_y_;
-    std::unordered_map<std::string, evget::IntervalTracker> device_intervals_;
+    evget::InternedString event_source_{kEventSourceName};
+
+    std::unordered_map<evget::InternedString, double> previous_absolute_x_;
+    std::unordered_map<evget::InternedString, double> previous_absolute_y_;
+    std::map<std::pair<evget::InternedString, std::int32_t>, double> previous_touch_x_;
+    std::map<std::pair<evget::InternedString, std::int32_t>, double> previous_touch_y_;
+    std::unordered_map<evget::InternedString, evget::IntervalTracker> device_intervals_;
 
     evget::DeviceType GetDeviceType(LibInputEvent& event, libinput_event_type event_type) const;
     static evget::ButtonAction GetButtonAction(libinput_button_state state);
@@ -77,16 +79,16 @@ private:
     static xkb_key_direction GetXkbDirection(libinput_key_state state);
     void SetRelativePosition(
         evget::MouseMove& builder,
-        const std::string& device_uuid,
+        evget::InternedString device_uuid,
         libinput_event_pointer& pointer_event
     );
     void SetTouchRelativePosition(
         evget::MouseMove& builder,
-        const std::string& device_uuid,
+        evget::InternedString device_uuid,
         std::int32_t seat_slot,
         libinput_event_touch& touch_event
     );
-    void ClearTouchPosition(const std::string& device_uuid, std::int32_t seat_slot);
+    void ClearTouchPosition(evget::InternedString device_uuid, std::int32_t seat_slot);
     void BuildTabletToolMove(
         evget::Data& data,
         const EventContext& ctx,
@@ -95,7 +97,7 @@ private:
     );
     void BuildScrollEvent(evget::Data& data, const EventContext& ctx, LibInputEvent& event);
     void
-    BuildTouchRelease(evget::Data& data, const EventContext& ctx, const std::string& device_uuid, LibInputEvent& event);
+    BuildTouchRelease(evget::Data& data, const EventContext& ctx, evget::InternedString device_uuid, LibInputEvent& event);
     template <evget::BuilderHasButtonName T>
     void SetButtonName(T& builder, std::uint32_t code);
 
@@ -114,7 +116,7 @@ T& EventTransformer::SetBaseFields(T& builder, const EventContext& ctx, std::uin
         .DeviceName(ctx.device_name)
         .DeviceId(ctx.device_uuid)
         .SystemEvent(ctx.system_event)
-        .EventSource(std::string{kEventSourceName});
+        .EventSource(event_source_);
     return SetModifierValues(builder);
 }
 
@@ -122,7 +124,7 @@ template <evget::BuilderHasButtonName T>
 void EventTransformer::SetButtonName(T& builder, std::uint32_t code) {
     const auto* name = libevdev_event_code_get_name(EV_KEY, code);
     if (name != nullptr) {
-        builder.ButtonName(name);
+        builder.ButtonName(evget::InternedString{name});
     }
 }
 
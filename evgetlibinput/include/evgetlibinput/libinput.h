@@ -8,7 +8,6 @@
 
 #include <libinput.h>
 #include <libudev.h>
-#include <sys/poll.h>
 
 #include <memory>
 #include <optional>
@@ -37,10 +36,24 @@ public:
     LibInputApi& operator=(const LibInputApi&) = delete;
 
     /**
-     * \brief Get the next event from libinput.
-     * \return the next event from the queue
+     * \brief Get the libinput file descriptor, which becomes readable when there is data to dispatch.
+     *        The descriptor remains owned by libinput.
+     * \return the file descriptor
      */
-    virtual evget::Result<LibInputEvent> GetEvent() = 0;
+    virtual int GetFd() = 0;
+
+    /**
+     * \brief Read any pending data from the file descriptor and queue the resulting events. Does not block.
+     * \return a result indicating whether dispatching succeeded
+     */
+    virtual evget::Result<void> Dispatch() = 0;
+
+    /**
+     * \brief Get the next queued event from libinput. Does not block.
+     * \return the next event from the queue, or `nullopt` if it is empty and `Dispatch` should be called
+     *         once the file descriptor is readable
+     */
+    virtual std::optional<LibInputEvent> GetEvent() = 0;
 
     /**
      * \brief Get the type of libinput event.
@@ -336,7 +349,11 @@ public:
      */
     static evget::Result<std::unique_ptr<LibInput>> New(const std::optional<std::string>& seat);
 
-    evget::Result<std::unique_ptr<libinput_event, decltype(&libinput_event_destroy)>> GetEvent() override;
+    int GetFd() override;
+
+    evget::Result<void> Dispatch() override;
+
+    std::optional<LibInputEvent> GetEvent() override;
 
     libinput_event_type GetEventType(libinput_event& event) override;
 
@@ -419,9 +436,6 @@ private:
 
     std::unique_ptr<udev, decltype(&udev_unref)> udev_context_{nullptr, udev_unref};
     std::unique_ptr<libinput, decltype(&libinput_unref)> libinput_context_{nullptr, libinput_unref};
-
-    pollfd pollfd_{};
-    bool wait_for_poll_{};
 };
 
 } // namespace evgetlibinput
@@ -6,7 +6,11 @@
 #ifndef EVGETLIBINPUT_NEXT_EVENT_H
 #define EVGETLIBINPUT_NEXT_EVENT_H
 
+#include <boost/asio/posix/stream_descriptor.hpp>
+
 #include <functional>
+#include <optional>
+#include <vector>
 
 #include "evget/input_event.h"
 #include "evget/next_event.h"
@@ -15,7 +19,8 @@
 namespace evgetlibinput {
 
 /**
- * \brief A libinput implementation for the `NextEvent` interface.
+ * \brief A libinput implementation for the `NextEvent` interface. The libinput file descriptor is registered with
+ *        the executor of the calling coroutine, so `Next` suspends without occupying a thread until events arrive.
  */
 class NextEvent : public evget::NextEvent<evget::InputEvent<LibInputEvent>> {
 public:
@@ -27,8 +32,25 @@ public:
 
     [[nodiscard]] boost::asio::awaitable<evget::Result<evget::InputEvent<LibInputEvent>>> Next() const override;
 
+    /**
+     * \brief Wait for the next event and then append every event that libinput has queued.
+     * \param events vector to append the events to
+     * \return a result indicating whether getting the events succeeded
+     */
+    [[nodiscard]] boost::asio::awaitable<evget::Result<void>> NextBatch(
+        std::vector<evget::InputEvent<LibInputEvent>>& events
+    ) const override;
+
+    NextEvent(const NextEvent&) = delete;
+    NextEvent(NextEvent&&) noexcept = delete;
+    NextEvent& operator=(const NextEvent&) = delete;
+    NextEvent& operator=(NextEvent&&) noexcept = delete;
+    ~NextEvent() override;
+
 private:
     std::reference_wrapper<LibInputApi> libinput_api_;
+    // Created on the first call to `Next`, as that is when the executor is known.
+    mutable std::optional<boost::asio::posix::stream_descriptor> descriptor_;
 };
 
 } // namespace evgetlibinput
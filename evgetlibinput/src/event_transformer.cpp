@@ -37,22 +37,22 @@ evget::Data evgetlibinput::EventTransformer::TransformEvent(evget::InputEvent<Li
         return {};
     }
 
-    const auto& device_uuid = device_ids_.Uuid(device);
+    auto device_uuid = device_ids_.Uuid(device);
     auto event_type = this->libinput_api_.get().GetEventType(*inner_event);
     auto ctx = EventContext{
         .timestamp = event.GetTimestamp(),
         .device_type = this->GetDeviceType(inner_event, event_type),
-        .device_name = libinput_api_.get().GetDeviceName(*device),
+        .device_name = evget::InternedString{libinput_api_.get().GetDeviceName(*device)},
         .device_uuid = device_uuid,
         .system_event = {},
     };
 
-    auto data = evget::Data{};
+    auto data = NewData();
     switch (event_type) {
         // xf86-input-libinput uses xf86PostMotionEventM which is mouse move:
         // https://gitlab.freedesktop.org/xorg/driver/xf86-input-libinput/-/blob/ac862672e4d04e78f2b647af9d3d14544454e4b9/src/xf86libinput.c#L1647
         case LIBINPUT_EVENT_POINTER_MOTION: {
-            ctx.system_event = EVGET_STRINGIFY(LIBINPUT_EVENT_POINTER_MOTION);
+            ctx.system_event = evget::InternedString{EVGET_STRINGIFY(LIBINPUT_EVENT_POINTER_MOTION)};
             auto* pointer_event = libinput_api_.get().GetPointerEvent(*inner_event);
             auto event_time = libinput_api_.get().GetPointerTimeMicroseconds(*pointer_event);
 
@@ -67,7 +67,7 @@ evget::Data evgetlibinput::EventTransformer::TransformEvent(evget::InputEvent<Li
         // xf86-input-libinput uses xf86PostMotionEventM which is mouse move:
         // https://gitlab.freedesktop.org/xorg/driver/xf86-input-libinput/-/blob/ac862672e4d04e78f2b647af9d3d14544454e4b9/src/xf86libinput.c#L1675
         case LIBINPUT_EVENT_POINTER_MOTION_ABSOLUTE: {
-            ctx.system_event = EVGET_STRINGIFY(LIBINPUT_EVENT_POINTER_MOTION_ABSOLUTE);
+            ctx.system_event = evget::InternedString{EVGET_STRINGIFY(LIBINPUT_EVENT_POINTER_MOTION_ABSOLUTE)};
             auto* pointer_event = libinput_api_.get().GetPointerEvent(*inner_event);
             auto event_time = libinput_api_.get().GetPointerTimeMicroseconds(*pointer_event);
 
@@ -81,7 +81,7 @@ evget::Data evgetlibinput::EventTransformer::TransformEvent(evget::InputEvent<Li
         // xf86-input-libinput uses xf86PostButtonEvent which is mouse click:
         // https://gitlab.freedesktop.org/xorg/driver/xf86-input-libinput/-/blob/ac862672e4d04e78f2b647af9d3d14544454e4b9/src/xf86libinput.c#L1703
         case LIBINPUT_EVENT_POINTER_BUTTON: {
-            ctx.system_event = EVGET_STRINGIFY(LIBINPUT_EVENT_POINTER_BUTTON);
+            ctx.system_event = evget::InternedString{EVGET_STRINGIFY(LIBINPUT_EVENT_POINTER_BUTTON)};
             auto* pointer_event = libinput_api_.get().GetPointerEvent(*inner_event);
             auto event_time = libinput_api_.get().GetPointerTimeMicroseconds(*pointer_event);
             auto button_code = libinput_api_.get().GetPointerButton(*pointer_event);
@@ -98,7 +98,7 @@ evget::Data evgetlibinput::EventTransformer::TransformEvent(evget::InputEvent<Li
         // xf86-input-libinput uses xf86PostProximityEventM and posts a motion event on proximity-in:
         // https://gitlab.freedesktop.org/xorg/driver/xf86-input-libinput/-/blob/ac862672e4d04e78f2b647af9d3d14544454e4b9/src/xf86libinput.c#L2479
         case LIBINPUT_EVENT_TABLET_TOOL_PROXIMITY: {
-            ctx.system_event = EVGET_STRINGIFY(LIBINPUT_EVENT_TABLET_TOOL_PROXIMITY);
+            ctx.system_event = evget::InternedString{EVGET_STRINGIFY(LIBINPUT_EVENT_TABLET_TOOL_PROXIMITY)};
             auto* tool_event = libinput_api_.get().GetTabletToolEvent(*inner_event);
             auto proximity_state = libinput_api_.get().GetTabletToolProximityState(*tool_event);
 
@@ -112,7 +112,7 @@ evget::Data evgetlibinput::EventTransformer::TransformEvent(evget::InputEvent<Li
         // xf86-input-libinput uses xf86PostMotionEventM via xf86libinput_post_tablet_motion which is mouse move:
         // https://gitlab.freedesktop.org/xorg/driver/xf86-input-libinput/-/blob/ac862672e4d04e78f2b647af9d3d14544454e4b9/src/xf86libinput.c#L2368
         case LIBINPUT_EVENT_TABLET_TOOL_AXIS: {
-            ctx.system_event = EVGET_STRINGIFY(LIBINPUT_EVENT_TABLET_TOOL_AXIS);
+            ctx.system_event = evget::InternedString{EVGET_STRINGIFY(LIBINPUT_EVENT_TABLET_TOOL_AXIS)};
             auto* tool_event = libinput_api_.get().GetTabletToolEvent(*inner_event);
             auto event_time = libinput_api_.get().GetTabletToolTimeMicroseconds(*tool_event);
 
@@ -122,7 +122,7 @@ evget::Data evgetlibinput::EventTransformer::TransformEvent(evget::InputEvent<Li
         // xf86-input-libinput uses xf86PostButtonEventP and xf86libinput_post_tablet_motion is mouse move and click:
         // https://gitlab.freedesktop.org/xorg/driver/xf86-input-libinput/-/blob/ac862672e4d04e78f2b647af9d3d14544454e4b9/src/xf86libinput.c#L2233
         case LIBINPUT_EVENT_TABLET_TOOL_TIP: {
-            ctx.system_event = EVGET_STRINGIFY(LIBINPUT_EVENT_TABLET_TOOL_TIP);
+            ctx.system_event = evget::InternedString{EVGET_STRINGIFY(LIBINPUT_EVENT_TABLET_TOOL_TIP)};
             auto* tool_event = libinput_api_.get().GetTabletToolEvent(*inner_event);
             auto event_time = libinput_api_.get().GetTabletToolTimeMicroseconds(*tool_event);
 
@@ -139,7 +139,7 @@ evget::Data evgetlibinput::EventTransformer::TransformEvent(evget::InputEvent<Li
         // xf86-input-libinput uses xf86PostButtonEventP for mouse click:
         // https://gitlab.freedesktop.org/xorg/driver/xf86-input-libinput/-/blob/ac862672e4d04e78f2b647af9d3d14544454e4b9/src/xf86libinput.c#L2256
         case LIBINPUT_EVENT_TABLET_TOOL_BUTTON: {
-            ctx.system_event = EVGET_STRINGIFY(LIBINPUT_EVENT_TABLET_TOOL_BUTTON);
+            ctx.system_event = evget::InternedString{EVGET_STRINGIFY(LIBINPUT_EVENT_TABLET_TOOL_BUTTON)};
             auto* tool_event = libinput_api_.get().GetTabletToolEvent(*inner_event);
             auto event_time = libinput_api_.get().GetTabletToolTimeMicroseconds(*tool_event);
 
@@ -156,7 +156,7 @@ evget::Data evgetlibinput::EventTransformer::TransformEvent(evget::InputEvent<Li
         // xf86-input-libinput uses xf86PostButtonEvent which is mouse click:
         // https://gitlab.freedesktop.org/xorg/driver/xf86-input-libinput/-/blob/ac862672e4d04e78f2b647af9d3d14544454e4b9/src/xf86libinput.c#L2526
         case LIBINPUT_EVENT_TABLET_PAD_BUTTON: {
-            ctx.system_event = EVGET_STRINGIFY(LIBINPUT_EVENT_TABLET_PAD_BUTTON);
+            ctx.system_event = evget::InternedString{EVGET_STRINGIFY(LIBINPUT_EVENT_TABLET_PAD_BUTTON)};
             auto* pad_event = libinput_api_.get().GetTabletPadEvent(*inner_event);
             auto event_time = libinput_api_.get().GetTabletPadTimeMicroseconds(*pad_event);
 
@@ -172,7 +172,7 @@ evget::Data evgetlibinput::EventTransformer::TransformEvent(evget::InputEvent<Li
         // xf86-input-libinput uses xf86PostTouchEvent which matches motion and button press:
         // https://gitlab.freedesktop.org/xorg/driver/xf86-input-libinput/-/blob/ac862672e4d04e78f2b647af9d3d14544454e4b9/src/xf86libinput.c#L1965
         case LIBINPUT_EVENT_TOUCH_DOWN: {
-            ctx.system_event = EVGET_STRINGIFY(LIBINPUT_EVENT_TOUCH_DOWN);
+            ctx.system_event = evget::InternedString{EVGET_STRINGIFY(LIBINPUT_EVENT_TOUCH_DOWN)};
             auto* touch_event = libinput_api_.get().GetTouchEvent(*inner_event);
             auto event_time = libinput_api_.get().GetTouchTimeMicroseconds(*touch_event);
 
@@ -194,7 +194,7 @@ evget::Data evgetlibinput::EventTransformer::TransformEvent(evget::InputEvent<Li
         // xf86-input-libinput uses xf86PostTouchEvent which matches a motion event:
         // https://gitlab.freedesktop.org/xorg/driver/xf86-input-libinput/-/blob/ac862672e4d04e78f2b647af9d3d14544454e4b9/src/xf86libinput.c#L1965
         case LIBINPUT_EVENT_TOUCH_MOTION: {
-            ctx.system_event = EVGET_STRINGIFY(LIBINPUT_EVENT_TOUCH_MOTION);
+            ctx.system_event = evget::InternedString{EVGET_STRINGIFY(LIBINPUT_EVENT_TOUCH_MOTION)};
             auto* touch_event = libinput_api_.get().GetTouchEvent(*inner_event);
             auto event_time = libinput_api_.get().GetTouchTimeMicroseconds(*touch_event);
 
@@ -210,36 +210,36 @@ evget::Data evgetlibinput::EventTransformer::TransformEvent(evget::InputEvent<Li
         // xf86-input-libinput uses xf86PostTouchEvent for both UP and CANCEL which matches a button release:
         // https://gitlab.freedesktop.org/xorg/driver/xf86-input-libinput/-/blob/ac862672e4d04e78f2b647af9d3d14544454e4b9/src/xf86libinput.c#L1965
         case LIBINPUT_EVENT_TOUCH_CANCEL: {
-            ctx.system_event = EVGET_STRINGIFY(LIBINPUT_EVENT_TOUCH_CANCEL);
+            ctx.system_event = evget::InternedString{EVGET_STRINGIFY(LIBINPUT_EVENT_TOUCH_CANCEL)};
             BuildTouchRelease(data, ctx, device_uuid, inner_event);
             break;
         }
         case LIBINPUT_EVENT_TOUCH_UP: {
-            ctx.system_event = EVGET_STRINGIFY(LIBINPUT_EVENT_TOUCH_UP);
+            ctx.system_event = evget::InternedString{EVGET_STRINGIFY(LIBINPUT_EVENT_TOUCH_UP)};
             BuildTouchRelease(data, ctx, device_uuid, inner_event);
             break;
         }
         // xf86-input-libinput uses xf86PostMotionEventM with scroll valuators for all scroll event types:
         // https://gitlab.freedesktop.org/xorg/driver/xf86-input-libinput/-/blob/ac862672e4d04e78f2b647af9d3d14544454e4b9/src/xf86libinput.c#L1922
         case LIBINPUT_EVENT_POINTER_SCROLL_WHEEL: {
-            ctx.system_event = EVGET_STRINGIFY(LIBINPUT_EVENT_POINTER_SCROLL_WHEEL);
+            ctx.system_event = evget::InternedString{EVGET_STRINGIFY(LIBINPUT_EVENT_POINTER_SCROLL_WHEEL)};
             BuildScrollEvent(data, ctx, inner_event);
             break;
         }
         case LIBINPUT_EVENT_POINTER_SCROLL_FINGER: {
-            ctx.system_event = EVGET_STRINGIFY(LIBINPUT_EVENT_POINTER_SCROLL_FINGER);
+            ctx.system_event = evget::InternedString{EVGET_STRINGIFY(LIBINPUT_EVENT_POINTER_SCROLL_FINGER)};
             BuildScrollEvent(data, ctx, inner_event);
             break;
         }
         case LIBINPUT_EVENT_POINTER_SCROLL_CONTINUOUS: {
-            ctx.system_event = EVGET_STRINGIFY(LIBINPUT_EVENT_POINTER_SCROLL_CONTINUOUS);
+            ctx.system_event = evget::InternedString{EVGET_STRINGIFY(LIBINPUT_EVENT_POINTER_SCROLL_CONTINUOUS)};
             BuildScrollEvent(data, ctx, inner_event);
             break;
         }
         // xf86-input-libinput uses xf86PostKeyboardEvent which is a key event:
         // https://gitlab.freedesktop.org/xorg/driver/xf86-input-libinput/-/blob/ac862672e4d04e78f2b647af9d3d14544454e4b9/src/xf86libinput.c#L1724
         case LIBINPUT_EVENT_KEYBOARD_KEY: {
-            ctx.system_event = EVGET_STRINGIFY(LIBINPUT_EVENT_KEYBOARD_KEY);
+            ctx.system_event = evget::InternedString{EVGET_STRINGIFY(LIBINPUT_EVENT_KEYBOARD_KEY)};
             auto* keyboard_event = libinput_api_.get().GetKeyboardEvent(*inner_event);
             auto event_time = libinput_api_.get().GetKeyboardTimeMicroseconds(*keyboard_event);
 
@@ -261,10 +261,10 @@ evget::Data evgetlibinput::EventTransformer::TransformEvent(evget::InputEvent<Li
             builder.Button(static_cast<int>(key_code)).Action(action);
 
             if (key_name.has_value()) {
-                builder.ButtonName(std::move(*key_name));
+                builder.ButtonName(evget::InternedString{*key_name});
             }
             if (character.has_value()) {
-                builder.Character(std::move(*character));
+                builder.Character(evget::InternedString{*character});
             }
 
             builder.Build(data);
@@ -274,7 +274,7 @@ evget::Data evgetlibinput::EventTransformer::TransformEvent(evget::InputEvent<Li
         }
         // xf86-input-libinput does not implement LIBINPUT_EVENT_TABLET_PAD_KEY, Key is the closest equivalent.
         case LIBINPUT_EVENT_TABLET_PAD_KEY: {
-            ctx.system_event = EVGET_STRINGIFY(LIBINPUT_EVENT_TABLET_PAD_KEY);
+            ctx.system_event = evget::InternedString{EVGET_STRINGIFY(LIBINPUT_EVENT_TABLET_PAD_KEY)};
             auto* pad_event = libinput_api_.get().GetTabletPadEvent(*inner_event);
             auto event_time = libinput_api_.get().GetTabletPadTimeMicroseconds(*pad_event);
 
@@ -336,7 +336,7 @@ void evgetlibinput::EventTransformer::BuildScrollEvent(
 void evgetlibinput::EventTransformer::BuildTouchRelease(
     evget::Data& data,
     const EventContext& ctx,
-    const std::string& device_uuid,
+    evget::InternedString device_uuid,
     LibInputEvent& event
 ) {
     auto* touch_event = libinput_api_.get().GetTouchEvent(*event);
@@ -360,7 +360,7 @@ void evgetlibinput::EventTransformer::BuildTouchRelease(
 
 void evgetlibinput::EventTransformer::SetRelativePosition(
     evget::MouseMove& builder,
-    const std::string& device_uuid,
+    evget::InternedString device_uuid,
     libinput_event_pointer& pointer_event
 ) {
     auto absolute_x = libinput_api_.get().GetPointerAbsoluteX(pointer_event, dimensions_.width);
@@ -379,7 +379,7 @@ void evgetlibinput::EventTransformer::SetRelativePosition(
 
 void evgetlibinput::EventTransformer::SetTouchRelativePosition(
     evget::MouseMove& builder,
-    const std::string& device_uuid,
+    evget::InternedString device_uuid,
     std::int32_t seat_slot,
     libinput_event_touch& touch_event
 ) {
@@ -399,7 +399,7 @@ void evgetlibinput::EventTransformer::SetTouchRelativePosition(
     previous_touch_y_[key] = absolute_y;
 }
 
-void evgetlibinput::EventTransformer::ClearTouchPosition(const std::string& device_uuid, std::int32_t seat_slot) {
+void evgetlibinput::EventTransformer::ClearTouchPosition(evget::InternedString device_uuid, std::int32_t seat_slot) {
     auto key = std::make_pair(device_uuid, seat_slot);
     previous_touch_x_.erase(key);
     previous_touch_y_.erase(key);
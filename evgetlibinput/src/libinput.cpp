@@ -4,7 +4,6 @@
 #include <fcntl.h>
 #include <libinput.h>
 #include <libudev.h>
-#include <poll.h>
 #include <unistd.h>
 
 #include <cerrno>
@@ -52,11 +51,6 @@ evget::Result<std::unique_ptr<evgetlibinput::LibInput>> evgetlibinput::LibInput:
         };
     }
 
-    lib_input->pollfd_.fd = libinput_get_fd(lib_input->libinput_context_.get());
-    lib_input->pollfd_.events = POLLIN; // NOLINT(misc-include-cleaner)
-    lib_input->pollfd_.revents = 0;
-    lib_input->wait_for_poll_ = true;
-
     const std::string& seat_name = seat.value_or("seat0");
     auto assign = libinput_udev_assign_seat(lib_input->libinput_context_.get(), seat_name.c_str());
     if (assign != 0) {
@@ -69,37 +63,28 @@ evget::Result<std::unique_ptr<evgetlibinput::LibInput>> evgetlibinput::LibInput:
     return lib_input;
 }
 
-evget::Result<evgetlibinput::LibInputEvent> evgetlibinput::LibInput::GetEvent() {
-    libinput_event* event = nullptr;
-    // Loop until there is a non-null event, polling and dispatching the context if the current
-    // event is null.
-    while (event == nullptr) {
-        if (wait_for_poll_) {
-            int poll_result = 0;
-            // NOLINTNEXTLINE(cppcoreguidelines-avoid-do-while)
-            do {
-                poll_result = poll(&pollfd_, 1, -1); // NOLINT(misc-include-cleaner)
-            } while (poll_result < 0 && errno == EINTR);
-
-            if (poll_result <= 0) {
-                return evget::Err{
-                    {.error_type = evget::ErrorType::kEventHandlerError, .message = "polling for events failed"}
-                };
-            }
-
-            auto dispatch = libinput_dispatch(libinput_context_.get());
-            if (dispatch != 0) {
-                return evget::Err{
-                    {.error_type = evget::ErrorType::kEventHandlerError, .message = "unable to dispatch next event"}
-                };
-            }
-        }
-
-        event = libinput_get_event(libinput_context_.get());
-        wait_for_poll_ = event == nullptr;
+int evgetlibinput::LibInput::GetFd() {
+    return libinput_get_fd(libinput_context_.get());
+}
+
+evget::Result<void> evgetlibinput::LibInput::Dispatch() {
+    auto dispatch = libinput_dispatch(libinput_context_.get());
+    if (dispatch != 0) {
+        return evget::Err{
+            {.error_type = evget::ErrorType::kEventHandlerError, .message = "unable to dispatch next event"}
+        };
+    }
+
+    return {};
+}
+
+std::optional<evgetlibinput::LibInputEvent> evgetlibinput::LibInput::GetEvent() {
+    auto* event = libinput_get_event(libinput_context_.get());
+    if (event == nullptr) {
+        return std::nullopt;
     }
 
-    return evget::Result<LibInputEvent>{{event, libinput_event_destroy}};
+    return LibInputEvent{event, libinput_event_destroy};
 }
 
 libinput_event_type evgetlibinput::LibInput::GetEventType(libinput_event& event) {
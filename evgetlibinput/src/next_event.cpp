@@ -1,6 +1,16 @@
 #include "evgetlibinput/next_event.h"
 
 #include <boost/asio/awaitable.hpp>
+#include <boost/asio/posix/descriptor_base.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <expected>
+#include <format>
+#include <utility>
+#include <vector>
 
 #include "evget/error.h"
 #include "evget/input_event.h"
@@ -8,7 +18,58 @@
 
 evgetlibinput::NextEvent::NextEvent(LibInputApi& libinput_api) : libinput_api_{libinput_api} {}
 
+evgetlibinput::NextEvent::~NextEvent() {
+    // The file descriptor is owned by libinput, so it must not be closed here.
+    if (descriptor_.has_value()) {
+        descriptor_->release();
+    }
+}
+
 boost::asio::awaitable<evget::Result<evget::InputEvent<evgetlibinput::LibInputEvent>>>
 evgetlibinput::NextEvent::Next() const {
-    co_return libinput_api_.get().GetEvent().transform([](auto event) { return evget::InputEvent{std::move(event)}; });
+    auto& libinput_api = libinput_api_.get();
+    while (true) {
+        auto event = libinput_api.GetEvent();
+        if (event.has_value()) {
+            co_return evget::InputEvent{*std::move(event)};
+        }
+
+        if (!descriptor_.has_value()) {
+            descriptor_.emplace(co_await boost::asio::this_coro::executor, libinput_api.GetFd());
+        }
+
+        boost::system::error_code error{};
+        co_await descriptor_->async_wait(
+            boost::asio::posix::descriptor_base::wait_read,
+            boost::asio::redirect_error(boost::asio::use_awaitable, error)
+        );
+        if (error) {
+            co_return evget::Err{
+                {.error_type = evget::ErrorType::kEventHandlerError,
+                 .message = std::format("waiting for events failed: {}", error.message())}
+            };
+        }
+
+        auto dispatch = libinput_api.Dispatch();
+        if (!dispatch.has_value()) {
+            co_return std::unexpected{dispatch.error()};
+        }
+    }
+}
+
+boost::asio::awaitable<evget::Result<void>> evgetlibinput::NextEvent::NextBatch(
+    std::vector<evget::InputEvent<LibInputEvent>>& events
+) const {
+    auto first = co_await Next();
+    if (!first.has_value()) {
+        co_return evget::Err{first.error()};
+    }
+    events.push_back(*std::move(first));
+
+    auto& libinput_api = libinput_api_.get();
+    while (auto event = libinput_api.GetEvent()) {
+        events.emplace_back(*std::move(event));
+    }
+
+    co_return evget::Result<void>{};
 }
@@ -7,6 +7,7 @@
 #include <xkbcommon/xkbcommon.h>
 
 #include <cstdint>
+#include <optional>
 
 #include "evget/error.h"
 #include "evgetlibinput/drm.h"
@@ -34,7 +35,9 @@ evgetlibinput::XkbCommon MakeUsXkb();
 
 class LibInputApiMock : public evgetlibinput::LibInputApi {
 public:
-    MOCK_METHOD(evget::Result<evgetlibinput::LibInputEvent>, GetEvent, (), (override));
+    MOCK_METHOD(int, GetFd, (), (override));
+    MOCK_METHOD(evget::Result<void>, Dispatch, (), (override));
+    MOCK_METHOD(std::optional<evgetlibinput::LibInputEvent>, GetEvent, (), (override));
     MOCK_METHOD(libinput_event_type, GetEventType, (libinput_event & event), (override));
     MOCK_METHOD(libinput_event_pointer*, GetPointerEvent, (libinput_event & event), (override));
     MOCK_METHOD(std::uint64_t, GetPointerTimeMicroseconds, (libinput_event_pointer & event), (override));
@@ -7,12 +7,17 @@
 #include <libinput.h>
 #include <linux/input-event-codes.h>
 
+#include <cstdint>
 #include <string>
 #include <utility>
+#include <variant>
 
 #include "common/test_helpers.h"
+#include "evget/event/button_action.h"
+#include "evget/event/device_type.h"
 #include "evget/event/entry.h"
-#include "evget/event/schema.h"
+#include "evget/event/interned_string.h"
+#include "evget/event/modifier_value.h"
 #include "evget/input_event.h"
 #include "evgetlibinput/libinput.h"
 
@@ -114,14 +119,14 @@ TEST(EvgetLibInputTransformer, TransformPointerMotion) {
 
     ASSERT_EQ(entries.size(), 1);
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseMove);
-    ASSERT_EQ(entries.at(0).Data().at(0), "");
-    ASSERT_FALSE(entries.at(0).Data().at(1).empty());
-    ASSERT_EQ(entries.at(0).Data().at(2), evget::FromDouble(2.5));
-    ASSERT_EQ(entries.at(0).Data().at(3), evget::FromDouble(-1.5));
-    ASSERT_EQ(entries.at(0).Data().at(4), kDeviceName);
-    ASSERT_FALSE(entries.at(0).Data().at(11).empty());
-    ASSERT_EQ(entries.at(0).Data().at(12), "LIBINPUT_EVENT_POINTER_MOTION");
-    ASSERT_EQ(entries.at(0).Data().at(14), "0");
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(entries.at(0).Data().at(0)));
+    ASSERT_TRUE(std::holds_alternative<evget::TimestampType>(entries.at(0).Data().at(1)));
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(2)), 2.5);
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(3)), -1.5);
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(4)), kDeviceName);
+    ASSERT_FALSE(std::get<evget::InternedString>(entries.at(0).Data().at(11)).View().empty());
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(12)), "LIBINPUT_EVENT_POINTER_MOTION");
+    ASSERT_EQ(std::get<evget::DeviceType>(entries.at(0).Data().at(14)), evget::DeviceType::kMouse);
 }
 
 TEST(EvgetLibInputTransformer, TransformPointerMotionSecondInterval) {
@@ -138,8 +143,8 @@ TEST(EvgetLibInputTransformer, TransformPointerMotionSecondInterval) {
     auto first = transformer.TransformEvent(MakeInputEvent());
     auto second = transformer.TransformEvent(MakeInputEvent());
 
-    ASSERT_EQ(first.Entries().at(0).Data().at(0), "");
-    ASSERT_EQ(second.Entries().at(0).Data().at(0), "2000");
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(first.Entries().at(0).Data().at(0)));
+    ASSERT_EQ(std::get<evget::IntervalType>(second.Entries().at(0).Data().at(0)), evget::IntervalType{2000});
 }
 
 TEST(EvgetLibInputTransformer, TransformPointerAbsoluteMotionFirstNoDelta) {
@@ -159,9 +164,9 @@ TEST(EvgetLibInputTransformer, TransformPointerAbsoluteMotionFirstNoDelta) {
     ASSERT_EQ(entries.size(), 1);
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseMove);
     // No previous absolute position, so no PositionX/Y is set.
-    ASSERT_EQ(entries.at(0).Data().at(2), "");
-    ASSERT_EQ(entries.at(0).Data().at(3), "");
-    ASSERT_EQ(entries.at(0).Data().at(12), "LIBINPUT_EVENT_POINTER_MOTION_ABSOLUTE");
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(entries.at(0).Data().at(2)));
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(entries.at(0).Data().at(3)));
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(12)), "LIBINPUT_EVENT_POINTER_MOTION_ABSOLUTE");
 }
 
 TEST(EvgetLibInputTransformer, TransformPointerAbsoluteMotionSecondComputesDelta) {
@@ -185,8 +190,8 @@ TEST(EvgetLibInputTransformer, TransformPointerAbsoluteMotionSecondComputesDelta
 
     ASSERT_EQ(entries.size(), 1);
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseMove);
-    ASSERT_EQ(entries.at(0).Data().at(2), evget::FromDouble(10.0));
-    ASSERT_EQ(entries.at(0).Data().at(3), evget::FromDouble(-5.0));
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(2)), 10.0);
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(3)), -5.0);
 }
 
 TEST(EvgetLibInputTransformer, TransformPointerButton) {
@@ -205,11 +210,11 @@ TEST(EvgetLibInputTransformer, TransformPointerButton) {
 
     ASSERT_EQ(entries.size(), 1);
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseClick);
-    ASSERT_EQ(entries.at(0).Data().at(12), "LIBINPUT_EVENT_POINTER_BUTTON");
-    ASSERT_EQ(entries.at(0).Data().at(14), "0");
-    ASSERT_EQ(entries.at(0).Data().at(16), std::to_string(BTN_LEFT));
-    ASSERT_EQ(entries.at(0).Data().at(17), "BTN_LEFT");
-    ASSERT_EQ(entries.at(0).Data().at(18), "0");
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(12)), "LIBINPUT_EVENT_POINTER_BUTTON");
+    ASSERT_EQ(std::get<evget::DeviceType>(entries.at(0).Data().at(14)), evget::DeviceType::kMouse);
+    ASSERT_EQ(std::get<std::int64_t>(entries.at(0).Data().at(16)), BTN_LEFT);
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(17)), "BTN_LEFT");
+    ASSERT_EQ(std::get<evget::ButtonAction>(entries.at(0).Data().at(18)), evget::ButtonAction::kPress);
 }
 
 TEST(EvgetLibInputTransformer, TransformPointerButtonRelease) {
@@ -228,9 +233,9 @@ TEST(EvgetLibInputTransformer, TransformPointerButtonRelease) {
 
     ASSERT_EQ(entries.size(), 1);
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseClick);
-    ASSERT_EQ(entries.at(0).Data().at(16), std::to_string(BTN_RIGHT));
-    ASSERT_EQ(entries.at(0).Data().at(17), "BTN_RIGHT");
-    ASSERT_EQ(entries.at(0).Data().at(18), "1");
+    ASSERT_EQ(std::get<std::int64_t>(entries.at(0).Data().at(16)), BTN_RIGHT);
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(17)), "BTN_RIGHT");
+    ASSERT_EQ(std::get<evget::ButtonAction>(entries.at(0).Data().at(18)), evget::ButtonAction::kRelease);
 }
 
 TEST(EvgetLibInputTransformer, TransformPointerScrollWheel) {
@@ -250,9 +255,9 @@ TEST(EvgetLibInputTransformer, TransformPointerScrollWheel) {
 
     ASSERT_EQ(entries.size(), 1);
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseScroll);
-    ASSERT_EQ(entries.at(0).Data().at(12), "LIBINPUT_EVENT_POINTER_SCROLL_WHEEL");
-    ASSERT_EQ(entries.at(0).Data().at(15), evget::FromDouble(15.0));
-    ASSERT_EQ(entries.at(0).Data().at(16), "");
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(12)), "LIBINPUT_EVENT_POINTER_SCROLL_WHEEL");
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(15)), 15.0);
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(entries.at(0).Data().at(16)));
 }
 
 TEST(EvgetLibInputTransformer, TransformKeyboardKeyNoModifiers) {
@@ -271,13 +276,13 @@ TEST(EvgetLibInputTransformer, TransformKeyboardKeyNoModifiers) {
 
     ASSERT_EQ(entries.size(), 1);
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kKey);
-    ASSERT_EQ(entries.at(0).Data().at(12), "LIBINPUT_EVENT_KEYBOARD_KEY");
-    ASSERT_EQ(entries.at(0).Data().at(14), "1");
-    ASSERT_EQ(entries.at(0).Data().at(15), std::to_string(KEY_A));
-    ASSERT_EQ(entries.at(0).Data().at(16), "a");
-    ASSERT_EQ(entries.at(0).Data().at(17), "a");
-    ASSERT_EQ(entries.at(0).Data().at(18), "0");
-    ASSERT_EQ(entries.at(0).Modifiers().size(), 0);
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(12)), "LIBINPUT_EVENT_KEYBOARD_KEY");
+    ASSERT_EQ(std::get<evget::DeviceType>(entries.at(0).Data().at(14)), evget::DeviceType::kKeyboard);
+    ASSERT_EQ(std::get<std::int64_t>(entries.at(0).Data().at(15)), KEY_A);
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(16)), "a");
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(17)), "a");
+    ASSERT_EQ(std::get<evget::ButtonAction>(entries.at(0).Data().at(18)), evget::ButtonAction::kPress);
+    ASSERT_TRUE(entries.at(0).Modifiers().Empty());
 }
 
 TEST(EvgetLibInputTransformer, TransformKeyboardKeyShiftHeld) {
@@ -310,23 +315,22 @@ TEST(EvgetLibInputTransformer, TransformKeyboardKeyShiftHeld) {
     const auto& shifted_entries = shifted.Entries();
     ASSERT_EQ(shifted_entries.size(), 1);
     ASSERT_EQ(shifted_entries.at(0).Type(), evget::EntryType::kKey);
-    ASSERT_EQ(shifted_entries.at(0).Data().at(12), "LIBINPUT_EVENT_KEYBOARD_KEY");
-    ASSERT_EQ(shifted_entries.at(0).Data().at(14), "1");
-    ASSERT_EQ(shifted_entries.at(0).Data().at(15), std::to_string(KEY_A));
-    ASSERT_EQ(shifted_entries.at(0).Data().at(16), "A");
-    ASSERT_EQ(shifted_entries.at(0).Data().at(17), "A");
-    ASSERT_EQ(shifted_entries.at(0).Data().at(18), "0");
-    ASSERT_EQ(shifted_entries.at(0).Modifiers().size(), 1);
-    ASSERT_EQ(shifted_entries.at(0).Modifiers().at(0), "0");
+    ASSERT_EQ(std::get<evget::InternedString>(shifted_entries.at(0).Data().at(12)), "LIBINPUT_EVENT_KEYBOARD_KEY");
+    ASSERT_EQ(std::get<evget::DeviceType>(shifted_entries.at(0).Data().at(14)), evget::DeviceType::kKeyboard);
+    ASSERT_EQ(std::get<std::int64_t>(shifted_entries.at(0).Data().at(15)), KEY_A);
+    ASSERT_EQ(std::get<evget::InternedString>(shifted_entries.at(0).Data().at(16)), "A");
+    ASSERT_EQ(std::get<evget::InternedString>(shifted_entries.at(0).Data().at(17)), "A");
+    ASSERT_EQ(std::get<evget::ButtonAction>(shifted_entries.at(0).Data().at(18)), evget::ButtonAction::kPress);
+    ASSERT_EQ(shifted_entries.at(0).Modifiers(), evget::ModifierSet{evget::ModifierValue::kShift});
 
     const auto& unshifted_entries = unshifted.Entries();
     ASSERT_EQ(unshifted_entries.size(), 1);
     ASSERT_EQ(unshifted_entries.at(0).Type(), evget::EntryType::kKey);
-    ASSERT_EQ(unshifted_entries.at(0).Data().at(15), std::to_string(KEY_A));
-    ASSERT_EQ(unshifted_entries.at(0).Data().at(16), "a");
-    ASSERT_EQ(unshifted_entries.at(0).Data().at(17), "a");
-    ASSERT_EQ(unshifted_entries.at(0).Data().at(18), "0");
-    ASSERT_EQ(unshifted_entries.at(0).Modifiers().size(), 0);
+    ASSERT_EQ(std::get<std::int64_t>(unshifted_entries.at(0).Data().at(15)), KEY_A);
+    ASSERT_EQ(std::get<evget::InternedString>(unshifted_entries.at(0).Data().at(16)), "a");
+    ASSERT_EQ(std::get<evget::InternedString>(unshifted_entries.at(0).Data().at(17)), "a");
+    ASSERT_EQ(std::get<evget::ButtonAction>(unshifted_entries.at(0).Data().at(18)), evget::ButtonAction::kPress);
+    ASSERT_TRUE(unshifted_entries.at(0).Modifiers().Empty());
 }
 
 TEST(EvgetLibInputTransformer, TransformTouchDownProducesMoveAndPress) {
@@ -348,12 +352,12 @@ TEST(EvgetLibInputTransformer, TransformTouchDownProducesMoveAndPress) {
 
     ASSERT_EQ(entries.size(), 2);
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseMove);
-    ASSERT_EQ(entries.at(0).Data().at(12), "LIBINPUT_EVENT_TOUCH_DOWN");
-    ASSERT_EQ(entries.at(0).Data().at(14), "3");
-    ASSERT_EQ(entries.at(0).Data().at(15), "7");
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(12)), "LIBINPUT_EVENT_TOUCH_DOWN");
+    ASSERT_EQ(std::get<evget::DeviceType>(entries.at(0).Data().at(14)), evget::DeviceType::kTouchscreen);
+    ASSERT_EQ(std::get<std::int64_t>(entries.at(0).Data().at(15)), 7);
     ASSERT_EQ(entries.at(1).Type(), evget::EntryType::kMouseClick);
-    ASSERT_EQ(entries.at(1).Data().at(15), "7");
-    ASSERT_EQ(entries.at(1).Data().at(18), "0");
+    ASSERT_EQ(std::get<std::int64_t>(entries.at(1).Data().at(15)), 7);
+    ASSERT_EQ(std::get<evget::ButtonAction>(entries.at(1).Data().at(18)), evget::ButtonAction::kPress);
 }
 
 TEST(EvgetLibInputTransformer, TransformTouchMotionComputesDelta) {
@@ -378,9 +382,9 @@ TEST(EvgetLibInputTransformer, TransformTouchMotionComputesDelta) {
 
     ASSERT_EQ(entries.size(), 1);
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseMove);
-    ASSERT_EQ(entries.at(0).Data().at(2), evget::FromDouble(3.0));
-    ASSERT_EQ(entries.at(0).Data().at(3), evget::FromDouble(4.0));
-    ASSERT_EQ(entries.at(0).Data().at(12), "LIBINPUT_EVENT_TOUCH_MOTION");
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(2)), 3.0);
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(3)), 4.0);
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(12)), "LIBINPUT_EVENT_TOUCH_MOTION");
 }
 
 TEST(EvgetLibInputTransformer, TransformTouchUpProducesMoveAndRelease) {
@@ -399,12 +403,12 @@ TEST(EvgetLibInputTransformer, TransformTouchUpProducesMoveAndRelease) {
 
     ASSERT_EQ(entries.size(), 2);
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseMove);
-    ASSERT_EQ(entries.at(0).Data().at(2), "");
-    ASSERT_EQ(entries.at(0).Data().at(15), "2");
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(entries.at(0).Data().at(2)));
+    ASSERT_EQ(std::get<std::int64_t>(entries.at(0).Data().at(15)), 2);
     ASSERT_EQ(entries.at(1).Type(), evget::EntryType::kMouseClick);
-    ASSERT_EQ(entries.at(1).Data().at(12), "LIBINPUT_EVENT_TOUCH_UP");
-    ASSERT_EQ(entries.at(1).Data().at(15), "2");
-    ASSERT_EQ(entries.at(1).Data().at(18), "1");
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(1).Data().at(12)), "LIBINPUT_EVENT_TOUCH_UP");
+    ASSERT_EQ(std::get<std::int64_t>(entries.at(1).Data().at(15)), 2);
+    ASSERT_EQ(std::get<evget::ButtonAction>(entries.at(1).Data().at(18)), evget::ButtonAction::kRelease);
 }
 
 TEST(EvgetLibInputTransformer, TransformTabletToolAxis) {
@@ -423,10 +427,10 @@ TEST(EvgetLibInputTransformer, TransformTabletToolAxis) {
 
     ASSERT_EQ(entries.size(), 1);
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseMove);
-    ASSERT_EQ(entries.at(0).Data().at(2), evget::FromDouble(1.25));
-    ASSERT_EQ(entries.at(0).Data().at(3), evget::FromDouble(-0.75));
-    ASSERT_EQ(entries.at(0).Data().at(12), "LIBINPUT_EVENT_TABLET_TOOL_AXIS");
-    ASSERT_EQ(entries.at(0).Data().at(14), "4");
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(2)), 1.25);
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(3)), -0.75);
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(12)), "LIBINPUT_EVENT_TABLET_TOOL_AXIS");
+    ASSERT_EQ(std::get<evget::DeviceType>(entries.at(0).Data().at(14)), evget::DeviceType::kTablet);
 }
 
 TEST(EvgetLibInputTransformer, TransformTabletToolButton) {
@@ -445,11 +449,11 @@ TEST(EvgetLibInputTransformer, TransformTabletToolButton) {
 
     ASSERT_EQ(entries.size(), 1);
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseClick);
-    ASSERT_EQ(entries.at(0).Data().at(12), "LIBINPUT_EVENT_TABLET_TOOL_BUTTON");
-    ASSERT_EQ(entries.at(0).Data().at(14), "4");
-    ASSERT_EQ(entries.at(0).Data().at(16), std::to_string(BTN_STYLUS));
-    ASSERT_EQ(entries.at(0).Data().at(17), "BTN_STYLUS");
-    ASSERT_EQ(entries.at(0).Data().at(18), "0");
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(12)), "LIBINPUT_EVENT_TABLET_TOOL_BUTTON");
+    ASSERT_EQ(std::get<evget::DeviceType>(entries.at(0).Data().at(14)), evget::DeviceType::kTablet);
+    ASSERT_EQ(std::get<std::int64_t>(entries.at(0).Data().at(16)), BTN_STYLUS);
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(17)), "BTN_STYLUS");
+    ASSERT_EQ(std::get<evget::ButtonAction>(entries.at(0).Data().at(18)), evget::ButtonAction::kPress);
 }
 
 TEST(EvgetLibInputTransformer, TransformTabletPadButton) {
@@ -468,10 +472,10 @@ TEST(EvgetLibInputTransformer, TransformTabletPadButton) {
 
     ASSERT_EQ(entries.size(), 1);
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseClick);
-    ASSERT_EQ(entries.at(0).Data().at(12), "LIBINPUT_EVENT_TABLET_PAD_BUTTON");
-    ASSERT_EQ(entries.at(0).Data().at(14), "4");
-    ASSERT_EQ(entries.at(0).Data().at(16), "3");
-    ASSERT_EQ(entries.at(0).Data().at(18), "1");
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(12)), "LIBINPUT_EVENT_TABLET_PAD_BUTTON");
+    ASSERT_EQ(std::get<evget::DeviceType>(entries.at(0).Data().at(14)), evget::DeviceType::kTablet);
+    ASSERT_EQ(std::get<std::int64_t>(entries.at(0).Data().at(16)), 3);
+    ASSERT_EQ(std::get<evget::ButtonAction>(entries.at(0).Data().at(18)), evget::ButtonAction::kRelease);
 }
 
 TEST(EvgetLibInputTransformer, TransformTabletPadKey) {
@@ -490,11 +494,11 @@ TEST(EvgetLibInputTransformer, TransformTabletPadKey) {
 
     ASSERT_EQ(entries.size(), 1);
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kKey);
-    ASSERT_EQ(entries.at(0).Data().at(12), "LIBINPUT_EVENT_TABLET_PAD_KEY");
-    ASSERT_EQ(entries.at(0).Data().at(14), "1");
-    ASSERT_EQ(entries.at(0).Data().at(15), std::to_string(KEY_F1));
-    ASSERT_EQ(entries.at(0).Data().at(16), "KEY_F1");
-    ASSERT_EQ(entries.at(0).Data().at(18), "0");
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(12)), "LIBINPUT_EVENT_TABLET_PAD_KEY");
+    ASSERT_EQ(std::get<evget::DeviceType>(entries.at(0).Data().at(14)), evget::DeviceType::kKeyboard);
+    ASSERT_EQ(std::get<std::int64_t>(entries.at(0).Data().at(15)), KEY_F1);
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(16)), "KEY_F1");
+    ASSERT_EQ(std::get<evget::ButtonAction>(entries.at(0).Data().at(18)), evget::ButtonAction::kPress);
 }
 
 TEST(EvgetLibInputTransformer, TransformTabletToolProximityInGeneratesMove) {
@@ -515,7 +519,7 @@ TEST(EvgetLibInputTransformer, TransformTabletToolProximityInGeneratesMove) {
 
     ASSERT_EQ(entries.size(), 1);
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseMove);
-    ASSERT_EQ(entries.at(0).Data().at(12), "LIBINPUT_EVENT_TABLET_TOOL_PROXIMITY");
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(12)), "LIBINPUT_EVENT_TABLET_TOOL_PROXIMITY");
 }
 
 TEST(EvgetLibInputTransformer, TransformTabletToolProximityOutProducesNothing) {
@@ -550,10 +554,10 @@ TEST(EvgetLibInputTransformer, TransformTabletToolTipProducesMoveAndClick) {
 
     ASSERT_EQ(entries.size(), 2);
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseMove);
-    ASSERT_EQ(entries.at(0).Data().at(2), evget::FromDouble(2.0));
-    ASSERT_EQ(entries.at(0).Data().at(3), evget::FromDouble(3.0));
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(2)), 2.0);
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(3)), 3.0);
     ASSERT_EQ(entries.at(1).Type(), evget::EntryType::kMouseClick);
-    ASSERT_EQ(entries.at(1).Data().at(18), "0");
+    ASSERT_EQ(std::get<evget::ButtonAction>(entries.at(1).Data().at(18)), evget::ButtonAction::kPress);
 }
 
 TEST(EvgetLibInputTransformer, DeviceTypeTouchpadFromFingerCount) {
@@ -572,7 +576,7 @@ TEST(EvgetLibInputTransformer, DeviceTypeTouchpadFromFingerCount) {
     const auto& entries = data.Entries();
 
     ASSERT_EQ(entries.size(), 1);
-    ASSERT_EQ(entries.at(0).Data().at(14), "2");
+    ASSERT_EQ(std::get<evget::DeviceType>(entries.at(0).Data().at(14)), evget::DeviceType::kTouchpad);
 }
 
 TEST(EvgetLibInputTransformer, DeviceTypeUnknownWhenNoCapabilities) {
@@ -591,7 +595,7 @@ TEST(EvgetLibInputTransformer, DeviceTypeUnknownWhenNoCapabilities) {
     const auto& entries = data.Entries();
 
     ASSERT_EQ(entries.size(), 1);
-    ASSERT_EQ(entries.at(0).Data().at(14), "5");
+    ASSERT_EQ(std::get<evget::DeviceType>(entries.at(0).Data().at(14)), evget::DeviceType::kUnknown);
 }
 
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
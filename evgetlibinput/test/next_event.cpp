@@ -0,0 +1,180 @@
+#include "evgetlibinput/next_event.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <boost/asio/awaitable.hpp>
+#include <libinput.h>
+#include <unistd.h>
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "common/test_helpers.h"
+#include "evget/async/scheduler/scheduler.h"
+#include "evget/error.h"
+#include "evget/input_event.h"
+#include "evgetlibinput/libinput.h"
+
+namespace {
+
+using testing::ByMove;
+using testing::InSequence;
+using testing::Return;
+
+using NextResult = evget::Result<evget::InputEvent<evgetlibinput::LibInputEvent>>;
+
+class Pipe {
+public:
+    Pipe() {
+        EXPECT_EQ(pipe(fds_.data()), 0);
+    }
+
+    Pipe(const Pipe&) = delete;
+    Pipe(Pipe&&) = delete;
+    Pipe& operator=(const Pipe&) = delete;
+    Pipe& operator=(Pipe&&) = delete;
+
+    ~Pipe() {
+        close(fds_[0]);
+        close(fds_[1]);
+    }
+
+    [[nodiscard]] int ReadEnd() const {
+        return fds_[0];
+    }
+
+    void Write() const {
+        const char byte{};
+        EXPECT_EQ(write(fds_[1], &byte, 1), 1);
+    }
+
+    void Read() const {
+        char byte{};
+        EXPECT_EQ(read(fds_[0], &byte, 1), 1);
+    }
+
+private:
+    std::array<int, 2> fds_{};
+};
+
+evgetlibinput::LibInputEvent MakeEvent() {
+    return {nullptr, libinput_event_destroy};
+}
+
+std::shared_ptr<std::optional<NextResult>> RunNext(evgetlibinput::NextEvent& next_event) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto result = std::make_shared<std::optional<NextResult>>();
+
+    scheduler->Spawn(
+        [](evgetlibinput::NextEvent& next_event,
+           std::shared_ptr<std::optional<NextResult>> result) -> boost::asio::awaitable<void> {
+            *result = co_await next_event.Next();
+        }(next_event, result)
+    );
+    scheduler->Join();
+
+    return result;
+}
+
+struct BatchResult {
+    std::optional<evget::Result<void>> result;
+    std::vector<evget::InputEvent<evgetlibinput::LibInputEvent>> events;
+};
+
+std::shared_ptr<BatchResult> RunNextBatch(evgetlibinput::NextEvent& next_event) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto result = std::make_shared<BatchResult>();
+
+    scheduler->Spawn(
+        [](evgetlibinput::NextEvent& next_event, std::shared_ptr<BatchResult> result) -> boost::asio::awaitable<void> {
+            result->result = co_await next_event.NextBatch(result->events);
+        }(next_event, result)
+    );
+    scheduler->Join();
+
+    return result;
+}
+
+} // namespace
+
+TEST(NextEventTest, QueuedEventReturnedWithoutWaiting) {
+    test::LibInputApiMock mock{};
+    EXPECT_CALL(mock, GetEvent()).WillOnce(Return(ByMove(std::optional{MakeEvent()})));
+    EXPECT_CALL(mock, GetFd()).Times(0);
+    EXPECT_CALL(mock, Dispatch()).Times(0);
+
+    auto result = [&mock] {
+        evgetlibinput::NextEvent next_event{mock};
+        return RunNext(next_event);
+    }();
+
+    ASSERT_TRUE(result->has_value());
+    ASSERT_TRUE(result->value().has_value());
+}
+
+TEST(NextEventTest, WaitsForReadableDescriptorBeforeDispatch) {
+    const Pipe pipe{};
+    test::LibInputApiMock mock{};
+    {
+        const InSequence sequence{};
+        EXPECT_CALL(mock, GetEvent()).WillOnce(Return(ByMove(std::optional<evgetlibinput::LibInputEvent>{})));
+        EXPECT_CALL(mock, GetFd()).WillOnce(Return(pipe.ReadEnd()));
+        EXPECT_CALL(mock, Dispatch()).WillOnce([&pipe] {
+            pipe.Read();
+            return evget::Result<void>{};
+        });
+        EXPECT_CALL(mock, GetEvent()).WillOnce(Return(ByMove(std::optional{MakeEvent()})));
+    }
+    pipe.Write();
+
+    auto result = [&mock] {
+        evgetlibinput::NextEvent next_event{mock};
+        return RunNext(next_event);
+    }();
+
+    ASSERT_TRUE(result->has_value());
+    ASSERT_TRUE(result->value().has_value());
+}
+
+TEST(NextEventTest, DispatchErrorReturned) {
+    const Pipe pipe{};
+    test::LibInputApiMock mock{};
+    EXPECT_CALL(mock, GetEvent()).WillOnce(Return(ByMove(std::optional<evgetlibinput::LibInputEvent>{})));
+    EXPECT_CALL(mock, GetFd()).WillOnce(Return(pipe.ReadEnd()));
+    EXPECT_CALL(mock, Dispatch())
+        .WillOnce(Return(evget::Err{{.error_type = evget::ErrorType::kEventHandlerError, .message = "dispatch"}}));
+    pipe.Write();
+
+    auto result = [&mock] {
+        evgetlibinput::NextEvent next_event{mock};
+        return RunNext(next_event);
+    }();
+
+    ASSERT_TRUE(result->has_value());
+    ASSERT_FALSE(result->value().has_value());
+}
+
+TEST(NextEventTest, NextBatchDrainsQueuedEvents) {
+    test::LibInputApiMock mock{};
+    {
+        const InSequence sequence{};
+        EXPECT_CALL(mock, GetEvent()).WillOnce(Return(ByMove(std::optional{MakeEvent()})));
+        EXPECT_CALL(mock, GetEvent()).WillOnce(Return(ByMove(std::optional{MakeEvent()})));
+        EXPECT_CALL(mock, GetEvent()).WillOnce(Return(ByMove(std::optional{MakeEvent()})));
+        EXPECT_CALL(mock, GetEvent()).WillOnce(Return(ByMove(std::optional<evgetlibinput::LibInputEvent>{})));
+    }
+    EXPECT_CALL(mock, GetFd()).Times(0);
+    EXPECT_CALL(mock, Dispatch()).Times(0);
+
+    auto result = [&mock] {
+        evgetlibinput::NextEvent next_event{mock};
+        return RunNextBatch(next_event);
+    }();
+
+    ASSERT_TRUE(result->result.has_value());
+    ASSERT_TRUE(result->result->has_value());
+    ASSERT_EQ(result->events.size(), 3);
+}
@@ -13,6 +13,7 @@
 #include <evget/event/button_action.h>
 #include <evget/event/data.h>
 #include <evget/event/device_type.h>
+#include <evget/event/interned_string.h>
 #include <evget/event/modifier_value.h>
 #include <evget/event/schema.h>
 #include <evgetx11/x11.h>
@@ -24,6 +25,7 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 #include "evget/event/concepts.h"
 #include "evget/event/mouse_click.h"
@@ -34,6 +36,15 @@ namespace evgetx11 {
 /// \brief Event source for the X11 backend.
 constexpr std::string_view kEventSourceName{"x11"};
 
+/**
+ * \brief Get the interned event source for the X11 backend, so that it is only interned once.
+ * \return the event source
+ */
+inline const evget::InternedString& EventSourceName() {
+    static const evget::InternedString event_source{kEventSourceName};
+    return event_source;
+}
+
 /**
  * \brief Handles processing different types of X11 input events and converting them to the
  *        evget data format.
@@ -101,9 +112,9 @@ public:
      * \brief Get the name of a button for a specific device.
      * \param device_id the ID of the device
      * \param button button identifier
-     * \return reference to the button name string
+     * \return reference to the button name
      */
-    [[nodiscard]] const std::string& GetButtonName(int device_id, int button) const;
+    [[nodiscard]] const evget::InternedString& GetButtonName(int device_id, int button) const;
 
     /**
      * \brief Get the device type for the given device ID and event type.
@@ -124,9 +135,9 @@ public:
     /**
      * \brief Get the UUID for the given device ID.
      * \param device_id the ID of the device
-     * \return reference to the UUID
+     * \return the interned UUID
      */
-    const std::string& GetDeviceUuid(int device_id);
+    evget::InternedString GetDeviceUuid(int device_id);
 
     /**
      * \brief Set the modifier state for a builder.
@@ -174,9 +185,9 @@ public:
 
 private:
     std::reference_wrapper<X11Api> x_wrapper_;
-    std::unordered_map<int, std::unordered_map<int, std::string>> button_map_;
+    std::unordered_map<int, std::unordered_map<int, evget::InternedString>> button_map_;
     std::unordered_map<int, evget::DeviceType> devices_;
-    std::unordered_map<int, std::string> id_to_name_;
+    std::unordered_map<int, evget::InternedString> id_to_name_;
     evget::DeviceId<int> device_ids_;
     int pointer_id_{};
 };
@@ -231,7 +242,7 @@ T& EventSwitch::SetWindowFields(T& builder) {
     auto window_size = x_wrapper_.get().GetWindowSize(*window);
 
     if (window_name.has_value()) {
-        builder.FocusWindowName(*window_name);
+        builder.FocusWindowName(std::move(*window_name));
     }
 
     if (window_position.has_value()) {
@@ -250,9 +261,7 @@ T& EventSwitch::SetWindowFields(T& builder) {
 template <typename T>
     requires evget::BuilderHasScreenFunction<T> && evget::BuilderHasDeviceName<T>
 T& EventSwitch::SetDeviceNameFields(T& builder, const XIRawEvent& event, int screen) {
-    auto name = id_to_name_.at(event.sourceid);
-
-    return builder.DeviceName(name).Screen(screen);
+    return builder.DeviceName(id_to_name_.at(event.sourceid)).Screen(screen);
 }
 
 void EventSwitch::AddMotionEvent(
@@ -269,10 +278,10 @@ void EventSwitch::AddMotionEvent(
         .Timestamp(date_time)
         .Device(GetDevice(event.sourceid, event.evtype))
         .DeviceId(GetDeviceUuid(event.sourceid))
-        .SystemEvent(system_event)
+        .SystemEvent(evget::InternedString{system_event})
         .PositionX(query_pointer.root_x)
         .PositionY(query_pointer.root_y)
-        .EventSource(std::string{kEventSourceName});
+        .EventSource(EventSourceName());
 
     SetModifierValue(query_pointer.modifier_state.effective, builder);
     SetWindowFields(builder);
@@ -298,13 +307,13 @@ void EventSwitch::AddButtonEvent(
         .Timestamp(date_time)
         .Device(GetDevice(event.sourceid, event.evtype))
         .DeviceId(GetDeviceUuid(event.sourceid))
-        .SystemEvent(system_event)
+        .SystemEvent(evget::InternedString{system_event})
         .PositionX(query_pointer.root_x)
         .PositionY(query_pointer.root_y)
         .Action(action)
         .Button(button)
         .ButtonName(button_map_[event.sourceid][button])
-        .EventSource(std::string{kEventSourceName});
+        .EventSource(EventSourceName());
     SetModifierValue(query_pointer.modifier_state.effective, builder);
     SetWindowFields(builder);
 
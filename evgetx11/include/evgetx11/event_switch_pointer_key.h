@@ -218,13 +218,13 @@ void EventSwitchPointerKey::KeyEvent(
         .PositionY(query_pointer.root_y)
         .Device(x_event_switch.GetDevice(raw_event.sourceid, raw_event.evtype))
         .DeviceId(x_event_switch.GetDeviceUuid(raw_event.sourceid))
-        .SystemEvent(system_event)
+        .SystemEvent(evget::InternedString{system_event})
         .Timestamp(event.GetTimestamp())
         .Action(action)
         .Button(raw_event.detail)
-        .Character(character)
-        .ButtonName(name)
-        .EventSource(std::string{kEventSourceName});
+        .Character(evget::InternedString{character})
+        .ButtonName(evget::InternedString{name})
+        .EventSource(EventSourceName());
 
     EventSwitch::SetModifierValue(query_pointer.modifier_state.effective, builder);
     x_event_switch.SetWindowFields(builder);
@@ -275,10 +275,10 @@ void EventSwitchPointerKey::ScrollEvent(
         .Timestamp(event.GetTimestamp())
         .Device(x_event_switch.GetDevice(raw_event.sourceid, raw_event.evtype))
         .DeviceId(x_event_switch.GetDeviceUuid(raw_event.sourceid))
-        .SystemEvent(system_event)
+        .SystemEvent(evget::InternedString{system_event})
         .PositionX(query_pointer.root_x)
         .PositionY(query_pointer.root_y)
-        .EventSource(std::string{kEventSourceName});
+        .EventSource(EventSourceName());
 
     EventSwitch::SetModifierValue(query_pointer.modifier_state.effective, builder);
     x_event_switch.SetWindowFields(builder);
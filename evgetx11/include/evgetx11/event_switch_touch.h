@@ -138,12 +138,12 @@ void EventSwitchTouch::TouchButton(
         .Timestamp(event.GetTimestamp())
         .Device(x_event_switch.GetDevice(raw_event.sourceid, raw_event.evtype))
         .DeviceId(x_event_switch.GetDeviceUuid(raw_event.sourceid))
-        .SystemEvent(system_event)
+        .SystemEvent(evget::InternedString{system_event})
         .PositionX(query_pointer.root_x)
         .PositionY(query_pointer.root_y)
         .Action(action)
         .TouchId(raw_event.detail)
-        .EventSource(std::string{kEventSourceName});
+        .EventSource(EventSourceName());
     EventSwitch::SetModifierValue(query_pointer.modifier_state.effective, builder);
     x_event_switch.SetWindowFields(builder);
     x_event_switch.SetDeviceNameFields(builder, raw_event, query_pointer.screen_number);
@@ -170,11 +170,11 @@ void EventSwitchTouch::TouchMotion(
         .Timestamp(event.GetTimestamp())
         .Device(x_event_switch.GetDevice(raw_event.sourceid, raw_event.evtype))
         .DeviceId(x_event_switch.GetDeviceUuid(raw_event.sourceid))
-        .SystemEvent(system_event)
+        .SystemEvent(evget::InternedString{system_event})
         .PositionX(query_pointer.root_x)
         .PositionY(query_pointer.root_y)
         .TouchId(raw_event.detail)
-        .EventSource(std::string{kEventSourceName});
+        .EventSource(EventSourceName());
     EventSwitch::SetModifierValue(query_pointer.modifier_state.effective, builder);
     x_event_switch.SetWindowFields(builder);
     x_event_switch.SetDeviceNameFields(builder, raw_event, query_pointer.screen_number);
@@ -189,7 +189,8 @@ void EventTransformer<Switches...>::RefreshDevices() {
 
 template <typename... Switches>
 evget::Data EventTransformer<Switches...>::TransformEvent(InputEvent event) {
-    evget::Data data{};
+    auto data = this->NewData();
+    x_wrapper_.get().ApplyEvent(event.ViewEvent());
     if (event.HasData()) {
         auto type = event.GetEventType();
 
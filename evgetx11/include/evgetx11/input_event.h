@@ -36,6 +36,13 @@ public:
      */
     [[nodiscard]] int GetEventType() const;
 
+    /**
+     * \brief Get a non-owning reference to the X11 event that was read from the display. This is available even if
+     *        the event has no data.
+     * \return reference to the X11 event
+     */
+    [[nodiscard]] const XEvent& ViewEvent() const;
+
     /**
      * \brief Get a non-owning reference to the event data. Must check if data is available first with HasData.
      * \tparam T The expected type of the event data
@@ -55,6 +62,12 @@ public:
      */
     static InputEvent NextEvent(X11Api& x_wrapper);
 
+    InputEvent(const InputEvent&) = delete;
+    InputEvent& operator=(const InputEvent&) = delete;
+    InputEvent(InputEvent&& other) noexcept;
+    InputEvent& operator=(InputEvent&& other) noexcept;
+    ~InputEvent() = default;
+
 private:
     /**
      * \brief Private constructor for creating InputEvent instances.
@@ -62,6 +75,12 @@ private:
      */
     explicit InputEvent(X11Api& x_wrapper);
 
+    /**
+     * \brief The cookie usually points into the event it was read from, so it must follow the event when moved.
+     * \param other the moved from event
+     */
+    void AdoptCookie(InputEvent& other);
+
     evget::InputEvent<XEvent> event_;
     XEventPointer cookie_;
 };
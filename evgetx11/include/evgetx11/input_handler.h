@@ -6,7 +6,11 @@
 #ifndef EVGETX11_INPUT_HANDLER_H
 #define EVGETX11_INPUT_HANDLER_H
 
+#include <boost/asio/posix/stream_descriptor.hpp>
+
 #include <functional>
+#include <optional>
+#include <vector>
 
 #include "evget/error.h"
 #include "evget/next_event.h"
@@ -17,7 +21,8 @@ namespace evgetx11 {
 
 /**
  * \brief Handles X11 input events by wrapping the X11 API. This class sets
- * event masks and checks that the X11 API is at least version 2.2.
+ * event masks and checks that the X11 API is at least version 2.2. The display connection is registered
+ * with the executor of the calling coroutine, so waiting for events does not occupy a thread.
  */
 class InputHandler : public evget::NextEvent<InputEvent> {
 public:
@@ -27,14 +32,30 @@ public:
      */
     explicit InputHandler(X11Api& x_wrapper);
 
+    InputHandler(const InputHandler&) = delete;
+    InputHandler(InputHandler&&) noexcept = delete;
+    InputHandler& operator=(const InputHandler&) = delete;
+    InputHandler& operator=(InputHandler&&) noexcept = delete;
+    ~InputHandler() override;
+
     /**
-     * \brief Get the next input event from the X11 system.
+     * \brief Get the next input event from the X11 system, suspending until the display connection is readable
+     *        if no events are pending.
      * \return the next input event
      */
     [[nodiscard]] boost::asio::awaitable<evget::Result<InputEvent>> Next() const override;
 
+    /**
+     * \brief Wait for the next input event and then append every event that can be read without blocking.
+     * \param events vector to append the events to
+     * \return a result indicating whether getting the events succeeded
+     */
+    [[nodiscard]] boost::asio::awaitable<evget::Result<void>> NextBatch(std::vector<InputEvent>& events) const override;
+
 private:
     std::reference_wrapper<X11Api> x_wrapper_;
+    // Created on the first wait, as that is when the executor is known.
+    mutable std::optional<boost::asio::posix::stream_descriptor> descriptor_;
 };
 
 /**
@@ -0,0 +1,173 @@
+/**
+ * \file window_query.h
+ * \brief Window values queried over XCB and the mapping from their replies to cached values.
+ */
+
+#ifndef EVGETX11_WINDOW_QUERY_H
+#define EVGETX11_WINDOW_QUERY_H
+
+#include <X11/X.h>
+#include <spdlog/spdlog.h>
+#include <xcb/xcb.h>
+#include <xcb/xproto.h>
+
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "evget/util.h"
+
+namespace evgetx11 {
+
+/**
+ * \brief Represents the dimensions of an X11 window.
+ */
+struct XWindowDimensions {
+    unsigned int width; ///< window width in pixels
+    unsigned int height; ///< window height in pixels
+};
+
+/// \brief Type alias for an XCB reply, which is allocated with `malloc`.
+template <typename T>
+using XcbReply = std::unique_ptr<T, decltype(&std::free)>;
+
+/**
+ * \brief Cached window values, where an unset outer optional means the value is stale.
+ */
+struct WindowCache {
+    std::optional<std::optional<Window>> active_window;
+    Window window{None};
+    std::optional<std::optional<std::string>> name;
+    std::optional<std::optional<XWindowDimensions>> position;
+    std::optional<std::optional<XWindowDimensions>> size;
+};
+
+/**
+ * \brief Replies to the requests sent for the stale values of a window, where null means that the request was not
+ *        sent or that it failed.
+ */
+struct WindowReplies {
+    XcbReply<xcb_get_property_reply_t> net_wm_name{nullptr, std::free}; ///< `_NET_WM_NAME` property reply
+    XcbReply<xcb_get_property_reply_t> wm_name{nullptr, std::free}; ///< `WM_NAME` property reply
+    XcbReply<xcb_get_geometry_reply_t> geometry{nullptr, std::free}; ///< window geometry reply
+    XcbReply<xcb_query_tree_reply_t> tree{nullptr, std::free}; ///< window tree reply
+    XcbReply<xcb_translate_coordinates_reply_t> translate{nullptr, std::free}; ///< coordinates relative to the root
+};
+
+/**
+ * \brief Wait for the reply to a request, if it was sent.
+ * \tparam F the XCB reply function for the request
+ * \param connection the XCB connection
+ * \param cookie the request cookie
+ * \return the reply, or null if the request was not sent or failed
+ */
+template <auto F, typename Cookie>
+auto TakeReply(xcb_connection_t* connection, const std::optional<Cookie>& cookie);
+
+/**
+ * \brief Set the stale values of a window cache from the replies to their requests. The name is taken from
+ *        `_NET_WM_NAME`, falling back to `WM_NAME` if it is empty or missing.
+ * \param cache the cache to update, where only stale values are set
+ * \param replies the replies to the requests for the stale values
+ * \param root the root window of the default screen
+ * \param translate sends a request to translate the window coordinates against another root and takes its reply,
+ *        which is only called for windows on another screen
+ */
+void SetWindowCache(
+    WindowCache& cache,
+    WindowReplies replies,
+    xcb_window_t root,
+    evget::Invocable<XcbReply<xcb_translate_coordinates_reply_t>, xcb_window_t> auto&& translate
+);
+
+/**
+ * \brief Get the value of a property reply as a string.
+ * \param reply the property reply
+ * \return the property value
+ */
+std::string PropertyString(const xcb_get_property_reply_t& reply);
+
+template <auto F, typename Cookie>
+auto TakeReply(xcb_connection_t* connection, const std::optional<Cookie>& cookie) {
+    using Reply = std::remove_pointer_t<decltype(F(connection, *cookie, nullptr))>;
+    if (!cookie.has_value()) {
+        return XcbReply<Reply>{nullptr, std::free};
+    }
+
+    // Errors are returned with the reply rather than going to the Xlib error handler.
+    xcb_generic_error_t* error = nullptr;
+    XcbReply<Reply> reply{F(connection, *cookie, &error), std::free};
+    if (error != nullptr) {
+        spdlog::debug("X11 request {} failed with error {}", error->major_code, error->error_code);
+        // NOLINTNEXTLINE(cppcoreguidelines-no-malloc, hicpp-no-malloc)
+        std::free(error);
+        // A reply is not expected alongside an error, but it would not be valid if there was one.
+        reply.reset();
+    }
+    return reply;
+}
+
+void SetWindowCache(
+    WindowCache& cache,
+    WindowReplies replies,
+    xcb_window_t root,
+    evget::Invocable<XcbReply<xcb_translate_coordinates_reply_t>, xcb_window_t> auto&& translate
+) {
+    if (!cache.name.has_value()) {
+        if (replies.net_wm_name != nullptr && replies.net_wm_name->value_len != 0) {
+            cache.name.emplace(PropertyString(*replies.net_wm_name));
+        } else if (replies.wm_name != nullptr) {
+            cache.name.emplace(PropertyString(*replies.wm_name));
+        } else {
+            cache.name.emplace(std::nullopt);
+        }
+    }
+
+    const auto& geometry = replies.geometry;
+    if (!cache.size.has_value()) {
+        if (geometry == nullptr) {
+            cache.size.emplace(std::nullopt);
+        } else {
+            cache.size.emplace(XWindowDimensions{.width = geometry->width, .height = geometry->height});
+        }
+    }
+
+    if (cache.position.has_value()) {
+        return;
+    }
+    if (geometry == nullptr) {
+        cache.position.emplace(std::nullopt);
+        return;
+    }
+
+    // It shouldn't be necessary to check if the parent is the root, but it shouldn't hurt.
+    // See https://github.com/jordansissel/xdotool/pull/9 for more information.
+    if (replies.tree != nullptr && replies.tree->parent == geometry->root) {
+        cache.position.emplace(XWindowDimensions{
+            .width = static_cast<unsigned int>(geometry->x),
+            .height = static_cast<unsigned int>(geometry->y)
+        });
+        return;
+    }
+
+    // Windows on another screen need translating against their own root, which costs another round trip.
+    auto translate_reply = std::move(replies.translate);
+    if (geometry->root != root) {
+        translate_reply = translate(geometry->root);
+    }
+
+    XWindowDimensions position{};
+    if (translate_reply != nullptr) {
+        position = {
+            .width = static_cast<unsigned int>(translate_reply->dst_x),
+            .height = static_cast<unsigned int>(translate_reply->dst_y)
+        };
+    }
+    cache.position.emplace(position);
+}
+} // namespace evgetx11
+
+#endif
@@ -7,6 +7,7 @@
 #define EVGETX11_X11_API_H
 
 #include <X11/X.h>
+#include <X11/XKBlib.h>
 #include <X11/Xlib.h>
 #include <X11/extensions/XInput.h>
 #include <X11/extensions/XInput2.h>
@@ -19,6 +20,7 @@
 #include "evget/error.h"
 #include "evget/event/concepts.h"
 #include "evget/util.h"
+#include "evgetx11/window_query.h"
 
 // NOLINTBEGIN(modernize-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays)
 namespace evgetx11 {
@@ -57,14 +59,6 @@ void DisplayDeleter<F>::operator()(T* pointer) const {
 template <auto F>
 DisplayDeleter<F>::DisplayDeleter(Display& display) : display_{display} {}
 
-/**
- * \brief Represents the dimensions of an X11 window.
- */
-struct XWindowDimensions {
-    unsigned int width; ///< window width in pixels
-    unsigned int height; ///< window height in pixels
-};
-
 /// \brief Type alias for X11 event data with custom deleter.
 using XEventPointer = std::unique_ptr<XGenericEventCookie, std::function<void(XGenericEventCookie*)>>;
 
@@ -74,7 +68,7 @@ using XEventPointer = std::unique_ptr<XGenericEventCookie, std::function<void(XG
 struct QueryPointerResult {
     double root_x{}; ///< Root window X coordinate
     double root_y{}; ///< Root window Y coordinate
-    std::unique_ptr<unsigned char[], decltype(&XFree)> button_mask; ///< Button press mask
+    std::unique_ptr<unsigned char[], decltype(&XFree)> button_mask; ///< Button press mask, null if not queried
     XIModifierState modifier_state{}; ///< Modifier key states
     XIGroupState group_state{}; ///< Keyboard group state
     int screen_number{}; ///< Screen number
@@ -165,7 +159,7 @@ public:
      * This function uses the `_NET_WM_NAME` property, or the `WM_NAME` property as a fallback.
      *
      * \param window the window to get the name for
-     * \return optional window name, `nullopt` if unavailable
+     * \return optional interned window name, `nullopt` if unavailable or the window is `None` or `PointerRoot`
      */
     virtual std::optional<std::string> GetWindowName(Window window) = 0;
 
@@ -175,7 +169,7 @@ public:
      * This function calls `GetWindowAttributes`.
      *
      * \param window the window to get the size for
-     * \return optional window dimensions, `nullopt` if unavailable
+     * \return optional window dimensions, `nullopt` if unavailable or the window is `None` or `PointerRoot`
      */
     virtual std::optional<XWindowDimensions> GetWindowSize(Window window) = 0;
 
@@ -185,7 +179,7 @@ public:
      * This function calls `GetWindowAttributes`.
      *
      * \param window the window to get the position for
-     * \return optional window dimensions, `nullopt` if unavailable
+     * \return optional window dimensions, `nullopt` if unavailable or the window is `None` or `PointerRoot`
      */
     virtual std::optional<XWindowDimensions> GetWindowPosition(Window window) = 0;
 
@@ -208,6 +202,36 @@ public:
      */
     virtual XEvent NextEvent() = 0;
 
+    /**
+     * \brief Apply the state carried by an event read with `NextEvent` at the point that the event is transformed.
+     *
+     * Events may be read in batches before any of them are transformed, so state that queries depend on, such as the
+     * pointer position or the keyboard modifiers, must follow the event being transformed rather than the last event
+     * read. This must be called for every event, in the order they were read, before the event is transformed.
+     *
+     * \param event the event about to be transformed
+     */
+    virtual void ApplyEvent(const XEvent& event) = 0;
+
+    /**
+     * \brief Get the number of events that can be read without blocking.
+     *
+     * This function calls `XPending`.
+     *
+     * \return the number of pending events
+     */
+    virtual int Pending() = 0;
+
+    /**
+     * \brief Get the file descriptor of the display connection, which becomes readable when the server sends data.
+     *        The descriptor remains owned by the display.
+     *
+     * This function calls `XConnectionNumber`.
+     *
+     * \return the file descriptor
+     */
+    virtual int ConnectionFd() = 0;
+
     /**
      * \brief Get event data from an X11 event.
      *
@@ -256,6 +280,17 @@ private:
  *
  * This class provides the actual implementation of X11 library function calls,
  * wrapping the low-level X11 API.
+ *
+ * The active window and the name, position and size of the last queried window are cached. `PropertyNotify`,
+ * `ConfigureNotify` and `DestroyNotify` events are selected on the root and queried windows, and the cache is
+ * invalidated as they are read by `NextEvent`, so these values only cost a round trip when they change. Stale window
+ * values are requested together through the XCB connection underlying the display, and the replies are collected
+ * afterwards, so refreshing them costs a single round trip.
+ *
+ * Pointer queries are cached in a similar way. The modifier and group state is tracked from XKB state events, and the
+ * pointer position is only queried again after a raw motion or touch event, starting with the screen that the pointer
+ * was last on. Unlike the window cache, this state is updated by `ApplyEvent` as each event is transformed, so events
+ * read together in a batch see the state at their own position in the batch.
  */
 class X11 : public X11Api {
 public:
@@ -282,6 +317,9 @@ public:
     std::optional<XWindowDimensions> GetWindowPosition(Window window) override;
 
     XEvent NextEvent() override;
+    void ApplyEvent(const XEvent& event) override;
+    int Pending() override;
+    int ConnectionFd() override;
     XEventPointer EventData(XEvent& event) override;
 
     Status QueryVersion(int& major, int& minor) override;
@@ -310,6 +348,16 @@ public:
     static void SetMask(unsigned char* mask, std::initializer_list<int> events);
 
 private:
+    /**
+     * \brief The last queried pointer position.
+     */
+    struct PointerCache {
+        int device_id{};
+        double root_x{};
+        double root_y{};
+        int screen_number{};
+    };
+
     struct GetPropertyResult {
         std::uint64_t n_items{};
         Atom type{};
@@ -319,9 +367,12 @@ private:
 
     static constexpr int kMaskBits = 8;
 
-    [[nodiscard]] std::optional<XWindowAttributes> GetWindowAttributes(Window window) const;
+    std::optional<Window> QueryActiveWindow();
+    void QueryWindow(WindowCache& cache);
 
-    std::optional<Atom> GetAtom(const char* atom_name) const;
+    void WatchWindow(Window window);
+    void UpdateWindowCache(const XEvent& event);
+    void SelectXkbState();
 
     [[nodiscard]] GetPropertyResult GetProperty(Atom atom, Window window) const;
 
@@ -329,8 +380,21 @@ private:
 
     static constexpr int kUtf8MaxBytes = 4;
     static constexpr int kWindowPropertySize = 32;
+    static constexpr long kWatchWindowMask = PropertyChangeMask | StructureNotifyMask;
 
     std::reference_wrapper<Display> display_;
+    WindowCache window_cache_{};
+    std::optional<PointerCache> pointer_cache_;
+    int screen_number_{0};
+    std::optional<int> xi_opcode_;
+    std::optional<int> xkb_event_base_;
+    XkbStateRec xkb_state_{};
+
+    // Interned once rather than per event. Atoms are created if they do not exist yet, so they stay valid when a
+    // window manager starts later.
+    Atom net_active_window_ = XInternAtom(&display_.get(), "_NET_ACTIVE_WINDOW", False);
+    Atom net_wm_name_ = XInternAtom(&display_.get(), "_NET_WM_NAME", False);
+    Atom wm_name_ = XInternAtom(&display_.get(), "WM_NAME", False);
 
     std::unique_ptr<_XIM, decltype(&XCloseIM)> xim_ =
         std::unique_ptr<_XIM, decltype(&XCloseIM)>{XOpenIM(&display_.get(), nullptr, nullptr, nullptr), XCloseIM};
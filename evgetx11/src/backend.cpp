@@ -1,7 +1,9 @@
 #include "evgetx11/backend.h"
 
 #include <X11/Xlib.h>
+#include <spdlog/spdlog.h>
 
+#include <array>
 #include <expected>
 #include <format>
 #include <functional>
@@ -17,6 +19,18 @@
 #include "evgetx11/input_event.h"
 #include "evgetx11/input_handler.h"
 
+namespace {
+constexpr int kErrorTextSize = 256;
+
+int LogError(Display* display, XErrorEvent* error) {
+    // Windows can be destroyed at any time, so errors from requests made on them are expected and should not exit.
+    std::array<char, kErrorTextSize> text{};
+    XGetErrorText(display, error->error_code, text.data(), kErrorTextSize);
+    spdlog::debug("X11 request {} failed: {}", error->request_code, text.data());
+    return 0;
+}
+} // namespace
+
 evgetx11::Backend::Backend(std::unique_ptr<Display, decltype(&XCloseDisplay)> display)
     : display_(std::move(display)), api_(*this->display_) {}
 
@@ -35,6 +49,7 @@ evgetx11::Backend::Create(evget::Store& storage, const std::optional<std::string
         };
     }
 
+    XSetErrorHandler(LogError);
     auto backend = std::unique_ptr<Backend>(new Backend(std::move(display_ptr)));
 
     backend->transformer_ = std::move(EventTransformerBuilder{}.PointerKey(backend->api_).Touch()).Build(backend->api_);
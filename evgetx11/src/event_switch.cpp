@@ -3,6 +3,7 @@
 #include <X11/extensions/XI2.h>
 #include <X11/extensions/XInput2.h>
 #include <evget/event/device_type.h>
+#include <evget/event/interned_string.h>
 
 #include <cstddef>
 #include <optional>
@@ -39,7 +40,7 @@ void evgetx11::EventSwitch::SetButtonMap(const XIButtonClassInfo& button_info, i
             continue;
         }
         auto name = x_wrapper_.get().AtomName(label);
-        button_map_[device_id][button_index] = name ? name.get() : "";
+        button_map_[device_id][button_index] = evget::InternedString{name ? name.get() : ""};
     }
 }
 
@@ -75,11 +76,11 @@ void evgetx11::EventSwitch::RefreshDevices(
 
 evgetx11::EventSwitch::EventSwitch(X11Api& x_wrapper) : x_wrapper_{x_wrapper} {}
 
-const std::string& evgetx11::EventSwitch::GetDeviceUuid(int device_id) {
+evget::InternedString evgetx11::EventSwitch::GetDeviceUuid(int device_id) {
     return device_ids_.Uuid(device_id);
 }
 
-const std::string& evgetx11::EventSwitch::GetButtonName(int device_id, int button) const {
+const evget::InternedString& evgetx11::EventSwitch::GetButtonName(int device_id, int button) const {
     return button_map_.at(device_id).at(button);
 }
 
@@ -2,15 +2,43 @@
 
 #include <evget/event/schema.h>
 
+#include <utility>
+
 #include "evgetx11/x11.h"
 
 evgetx11::InputEvent::InputEvent(X11Api& x_wrapper)
     : event_{x_wrapper.NextEvent()}, cookie_{x_wrapper.EventData(event_.ViewData())} {}
 
+evgetx11::InputEvent::InputEvent(InputEvent&& other) noexcept
+    : event_{std::move(other.event_)}, cookie_{std::move(other.cookie_)} {
+    AdoptCookie(other);
+}
+
+evgetx11::InputEvent& evgetx11::InputEvent::operator=(InputEvent&& other) noexcept {
+    if (this != &other) {
+        event_ = std::move(other.event_);
+        cookie_ = std::move(other.cookie_);
+        AdoptCookie(other);
+    }
+    return *this;
+}
+
+void evgetx11::InputEvent::AdoptCookie(InputEvent& other) {
+    if (cookie_ != nullptr && cookie_.get() == &other.event_.ViewData().xcookie) {
+        auto deleter = std::move(cookie_.get_deleter());
+        static_cast<void>(cookie_.release());
+        cookie_ = XEventPointer{&event_.ViewData().xcookie, std::move(deleter)};
+    }
+}
+
 bool evgetx11::InputEvent::HasData() const {
     return cookie_ != nullptr;
 }
 
+const XEvent& evgetx11::InputEvent::ViewEvent() const {
+    return event_.ViewData();
+}
+
 int evgetx11::InputEvent::GetEventType() const {
     return cookie_->evtype;
 }
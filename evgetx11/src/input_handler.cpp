@@ -5,18 +5,32 @@
 #include <X11/extensions/XI2.h>
 #include <X11/extensions/XInput2.h>
 #include <boost/asio/awaitable.hpp>
+#include <boost/asio/posix/descriptor_base.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/system/error_code.hpp>
 #include <evget/error.h>
 #include <spdlog/spdlog.h>
 
 #include <array>
 #include <format>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "evgetx11/input_event.h"
 #include "evgetx11/x11.h"
 
 evgetx11::InputHandler::InputHandler(X11Api& x_wrapper) : x_wrapper_{x_wrapper} {}
 
+evgetx11::InputHandler::~InputHandler() {
+    // The file descriptor is owned by the display, so it must not be closed here.
+    if (descriptor_.has_value()) {
+        descriptor_->release();
+    }
+}
+
 evget::Result<void> evgetx11::InputHandlerBuilder::AnnounceVersion(X11Api& x_wrapper) {
     int major = kVersionMajor;
     int minor = kVersionMinor;
@@ -60,7 +74,45 @@ void evgetx11::InputHandlerBuilder::SetMask(X11Api& x_wrapper) {
 }
 
 boost::asio::awaitable<evget::Result<evgetx11::InputEvent>> evgetx11::InputHandler::Next() const {
-    co_return InputEvent::NextEvent(x_wrapper_.get());
+    auto& x_wrapper = x_wrapper_.get();
+    // `XPending` reads anything available on the connection without blocking, so `XNextEvent` is only called
+    // once an event is queued.
+    while (x_wrapper.Pending() == 0) {
+        if (!descriptor_.has_value()) {
+            descriptor_.emplace(co_await boost::asio::this_coro::executor, x_wrapper.ConnectionFd());
+        }
+
+        boost::system::error_code error{};
+        co_await descriptor_->async_wait(
+            boost::asio::posix::descriptor_base::wait_read,
+            boost::asio::redirect_error(boost::asio::use_awaitable, error)
+        );
+        if (error) {
+            co_return evget::Err{
+                {.error_type = evget::ErrorType::kEventHandlerError,
+                 .message = std::format("waiting for events failed: {}", error.message())}
+            };
+        }
+    }
+
+    co_return InputEvent::NextEvent(x_wrapper);
+}
+
+boost::asio::awaitable<evget::Result<void>> evgetx11::InputHandler::NextBatch(
+    std::vector<InputEvent>& events
+) const {
+    auto first = co_await Next();
+    if (!first.has_value()) {
+        co_return evget::Err{first.error()};
+    }
+    events.push_back(*std::move(first));
+
+    auto& x_wrapper = x_wrapper_.get();
+    for (auto pending = x_wrapper.Pending(); pending > 0; pending--) {
+        events.push_back(InputEvent::NextEvent(x_wrapper));
+    }
+
+    co_return evget::Result<void>{};
 }
 
 evget::Result<std::unique_ptr<evgetx11::InputHandler>> evgetx11::InputHandlerBuilder::Build(X11Api& x_wrapper) {
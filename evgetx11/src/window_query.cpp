@@ -0,0 +1,13 @@
+#include "evgetx11/window_query.h"
+
+#include <xcb/xproto.h>
+
+#include <cstddef>
+#include <string>
+
+std::string evgetx11::PropertyString(const xcb_get_property_reply_t& reply) {
+    return std::string{
+        static_cast<const char*>(xcb_get_property_value(&reply)),
+        static_cast<std::size_t>(xcb_get_property_value_length(&reply))
+    };
+}
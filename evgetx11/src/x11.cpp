@@ -1,16 +1,63 @@
 #include "evgetx11/x11.h"
 
+#include <X11/Xlib-xcb.h>
 #include <X11/Xutil.h>
 #include <X11/extensions/XInput.h>
 #include <X11/extensions/XInput2.h>
 #include <spdlog/spdlog.h>
+#include <xcb/xcb.h>
+#include <xcb/xproto.h>
 
 #include <array>
+#include <cstdint>
 #include <format>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
 
 // NOLINTBEGIN(modernize-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays,
 // cppcoreguidelines-pro-type-vararg, hicpp-vararg)
-evgetx11::X11::X11(Display& display) : display_{display} {}
+evgetx11::X11::X11(Display& display) : display_{display} {
+    // Receive changes to `_NET_ACTIVE_WINDOW`.
+    XSelectInput(&display_.get(), XDefaultRootWindow(&display_.get()), PropertyChangeMask);
+
+    int opcode = 0;
+    int event_base = 0;
+    int error_base = 0;
+    if (XQueryExtension(&display_.get(), "XInputExtension", &opcode, &event_base, &error_base) != 0) {
+        xi_opcode_ = opcode;
+    }
+
+    SelectXkbState();
+}
+
+void evgetx11::X11::SelectXkbState() {
+    int opcode = 0;
+    int event_base = 0;
+    int error_base = 0;
+    int major = XkbMajorVersion;
+    int minor = XkbMinorVersion;
+    if (XkbQueryExtension(&display_.get(), &opcode, &event_base, &error_base, &major, &minor) == 0) {
+        spdlog::info("XKB is not available, querying modifier state for every event");
+        return;
+    }
+
+    // Select before reading the initial state so that no change is missed in between.
+    if (XkbSelectEventDetails(
+            &display_.get(),
+            XkbUseCoreKbd,
+            XkbStateNotify,
+            XkbAllStateComponentsMask,
+            XkbAllStateComponentsMask
+        ) == 0 ||
+        XkbGetState(&display_.get(), XkbUseCoreKbd, &xkb_state_) != Success) {
+        spdlog::info("unable to track XKB state, querying modifier state for every event");
+        return;
+    }
+
+    xkb_event_base_ = event_base;
+}
 
 std::string
 evgetx11::X11::LookupCharacter(const XIRawEvent& event, const QueryPointerResult& query_pointer, KeySym& key_sym) {
@@ -120,21 +167,109 @@ std::unique_ptr<char[], decltype(&XFree)> evgetx11::X11::AtomName(Atom atom) {
     return {XGetAtomName(&display_.get(), atom), XFree};
 }
 
-std::optional<Atom> evgetx11::X11::GetAtom(const char* atom_name) const {
-    Atom atom = XInternAtom(&display_.get(), atom_name, True);
-    if (atom == None) {
-        spdlog::warn("failed to get {} atom", atom_name);
-        return std::nullopt;
-    }
-    return atom;
-}
-
 XEvent evgetx11::X11::NextEvent() {
     XEvent event;
     XNextEvent(&display_.get(), &event);
+    UpdateWindowCache(event);
     return event;
 }
 
+void evgetx11::X11::ApplyEvent(const XEvent& event) {
+    if (xkb_event_base_.has_value() && event.type == *xkb_event_base_) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        const auto& xkb_event = reinterpret_cast<const XkbEvent&>(event);
+        if (xkb_event.any.xkb_type == XkbStateNotify) {
+            const auto& state = xkb_event.state;
+            xkb_state_.mods = static_cast<unsigned char>(state.mods);
+            xkb_state_.base_mods = static_cast<unsigned char>(state.base_mods);
+            xkb_state_.latched_mods = static_cast<unsigned char>(state.latched_mods);
+            xkb_state_.locked_mods = static_cast<unsigned char>(state.locked_mods);
+            xkb_state_.group = static_cast<unsigned char>(state.group);
+            xkb_state_.base_group = static_cast<std::uint16_t>(state.base_group);
+            xkb_state_.latched_group = static_cast<std::uint16_t>(state.latched_group);
+            xkb_state_.locked_group = static_cast<unsigned char>(state.locked_group);
+        }
+        return;
+    }
+
+    // The cookie header is filled in by `XNextEvent`, so the event type is known before fetching the data.
+    if (event.type != GenericEvent || !xi_opcode_.has_value() || event.xcookie.extension != *xi_opcode_) {
+        return;
+    }
+
+    switch (event.xcookie.evtype) {
+        case XI_RawMotion:
+        case XI_RawTouchBegin:
+        case XI_RawTouchUpdate:
+        case XI_RawTouchEnd:
+            pointer_cache_.reset();
+            break;
+        default:
+            break;
+    }
+}
+
+void evgetx11::X11::UpdateWindowCache(const XEvent& event) {
+    switch (event.type) {
+        case PropertyNotify: {
+            const auto& property = event.xproperty;
+            if (property.window == XDefaultRootWindow(&display_.get()) &&
+                property.atom == net_active_window_) {
+                window_cache_.active_window.reset();
+            }
+            if (property.window == window_cache_.window &&
+                (property.atom == net_wm_name_ || property.atom == wm_name_)) {
+                window_cache_.name.reset();
+            }
+            break;
+        }
+        case ConfigureNotify:
+            if (event.xconfigure.window == window_cache_.window) {
+                window_cache_.position.reset();
+                window_cache_.size.reset();
+            }
+            break;
+        case DestroyNotify:
+            if (event.xdestroywindow.window == window_cache_.window) {
+                window_cache_ = {.active_window = std::nullopt};
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void evgetx11::X11::WatchWindow(Window window) {
+    if (window == window_cache_.window) {
+        return;
+    }
+
+    // Events are selected before the values are queried so that no change is missed in between. The root window
+    // keeps its `PropertyChangeMask` for `_NET_ACTIVE_WINDOW`.
+    auto root = XDefaultRootWindow(&display_.get());
+    if (window_cache_.window != None) {
+        XSelectInput(
+            &display_.get(),
+            window_cache_.window,
+            window_cache_.window == root ? PropertyChangeMask : NoEventMask
+        );
+    }
+    XSelectInput(&display_.get(), window, kWatchWindowMask);
+
+    window_cache_.window = window;
+    window_cache_.name.reset();
+    window_cache_.position.reset();
+    window_cache_.size.reset();
+}
+
+int evgetx11::X11::Pending() {
+    return XPending(&display_.get());
+}
+
+int evgetx11::X11::ConnectionFd() {
+    return XConnectionNumber(&display_.get());
+}
+
 evgetx11::XEventPointer evgetx11::X11::EventData(XEvent& event) {
     auto deleter = std::function<void(XGenericEventCookie*)>{DisplayDeleter<XFreeEventData>{display_.get()}};
     if (XGetEventData(&display_.get(), &event.xcookie) != 0 && (&event.xcookie)->type == GenericEvent) {
@@ -145,19 +280,40 @@ evgetx11::XEventPointer evgetx11::X11::EventData(XEvent& event) {
 }
 
 evgetx11::QueryPointerResult evgetx11::X11::QueryPointer(int device_id) {
+    if (xkb_event_base_.has_value() && pointer_cache_.has_value() && pointer_cache_->device_id == device_id) {
+        return QueryPointerResult{
+            .root_x = pointer_cache_->root_x,
+            .root_y = pointer_cache_->root_y,
+            .button_mask = {nullptr, XFree},
+            .modifier_state =
+                {.base = xkb_state_.base_mods,
+                 .latched = xkb_state_.latched_mods,
+                 .locked = xkb_state_.locked_mods,
+                 .effective = xkb_state_.mods},
+            .group_state =
+                {.base = xkb_state_.base_group,
+                 .latched = xkb_state_.latched_group,
+                 .locked = xkb_state_.locked_group,
+                 .effective = xkb_state_.group},
+            .screen_number = pointer_cache_->screen_number,
+        };
+    }
+
     Window _root_return = 0;
     Window _window_return = 0;
     double _win_x = 0;
     double _win_y = 0;
     double root_x = 0;
     double root_y = 0;
-    XIButtonState button_state;
-    XIModifierState modifier_state;
-    XIGroupState group_state;
-
-    auto screen_number = 0;
-    for (auto i = 0; i < XScreenCount(&display_.get()); i++) {
-        Screen* screen = XScreenOfDisplay(&display_.get(), i);
+    XIButtonState button_state{};
+    XIModifierState modifier_state{};
+    XIGroupState group_state{};
+
+    // The pointer is usually on the same screen as last time, so try that one before the others.
+    auto screen_count = XScreenCount(&display_.get());
+    for (auto i = 0; i < screen_count; i++) {
+        auto screen_number = (screen_number_ + i) % screen_count;
+        Screen* screen = XScreenOfDisplay(&display_.get(), screen_number);
         auto result = XIQueryPointer(
             &display_.get(),
             device_id,
@@ -173,7 +329,13 @@ evgetx11::QueryPointerResult evgetx11::X11::QueryPointer(int device_id) {
             &group_state
         );
         if (result == True) {
-            screen_number = i;
+            screen_number_ = screen_number;
+            pointer_cache_ = PointerCache{
+                .device_id = device_id,
+                .root_x = root_x,
+                .root_y = root_y,
+                .screen_number = screen_number
+            };
             break;
         }
     }
@@ -184,7 +346,7 @@ evgetx11::QueryPointerResult evgetx11::X11::QueryPointer(int device_id) {
         .button_mask = {button_state.mask, XFree},
         .modifier_state = modifier_state,
         .group_state = group_state,
-        .screen_number = screen_number,
+        .screen_number = screen_number_,
     };
 }
 
@@ -238,37 +400,26 @@ evgetx11::X11::GetPropertyResult evgetx11::X11::GetProperty(Atom atom, Window wi
 }
 
 std::optional<std::string> evgetx11::X11::GetWindowName(Window window) {
-    auto wm_name_atom = GetAtom("_NET_WM_NAME");
-    if (!wm_name_atom) {
+    if (window == None || window == PointerRoot) {
         return std::nullopt;
     }
 
-    auto name = GetProperty(*wm_name_atom, window);
-    if (name.n_items == 0) {
-        wm_name_atom = GetAtom("WM_NAME");
-        if (!wm_name_atom) {
-            return std::nullopt;
-        }
-        name = GetProperty(*wm_name_atom, window);
-    }
-
-    if (name.property == nullptr) {
-        return std::string{};
+    WatchWindow(window);
+    if (!window_cache_.name.has_value()) {
+        QueryWindow(window_cache_);
     }
-
-    // Reinterpret cast should be safe converting unsigned char to char.
-    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
-    return std::string{reinterpret_cast<const char*>(name.property.get()), name.n_items};
-    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+    return *window_cache_.name;
 }
 
 std::optional<Window> evgetx11::X11::GetActiveWindow() {
-    auto active_window = GetAtom("_NET_ACTIVE_WINDOW");
-    if (!active_window) {
-        return std::nullopt;
+    if (!window_cache_.active_window.has_value()) {
+        window_cache_.active_window = QueryActiveWindow();
     }
+    return *window_cache_.active_window;
+}
 
-    auto window = GetProperty(*active_window, XDefaultRootWindow(&display_.get()));
+std::optional<Window> evgetx11::X11::QueryActiveWindow() {
+    auto window = GetProperty(net_active_window_, XDefaultRootWindow(&display_.get()));
     if (window.n_items > 0 && window.size == kWindowPropertySize && window.property != nullptr) {
         // Reinterpret cast is required by X11.
         // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
@@ -293,66 +444,87 @@ std::optional<Window> evgetx11::X11::GetFocusWindow() {
     return window;
 }
 
-std::optional<XWindowAttributes> evgetx11::X11::GetWindowAttributes(Window window) const {
-    XWindowAttributes attributes;
-
-    if (window == 0) {
+std::optional<evgetx11::XWindowDimensions> evgetx11::X11::GetWindowSize(Window window) {
+    if (window == None || window == PointerRoot) {
         return std::nullopt;
     }
 
-    // XGetWindowAttributes returns non-zero on success.
-    if (XGetWindowAttributes(&display_.get(), window, &attributes) == 0) {
-        spdlog::warn("failed to get window attributes");
-        return std::nullopt;
+    WatchWindow(window);
+    if (!window_cache_.size.has_value()) {
+        QueryWindow(window_cache_);
     }
-
-    return attributes;
+    return *window_cache_.size;
 }
 
-std::optional<evgetx11::XWindowDimensions> evgetx11::X11::GetWindowSize(Window window) {
-    auto attributes = GetWindowAttributes(window);
-
-    if (!attributes.has_value()) {
+std::optional<evgetx11::XWindowDimensions> evgetx11::X11::GetWindowPosition(Window window) {
+    if (window == None || window == PointerRoot) {
         return std::nullopt;
     }
 
-    const unsigned int width = attributes->width;
-    const unsigned int height = attributes->height;
-
-    return {{.width = width, .height = height}};
+    WatchWindow(window);
+    if (!window_cache_.position.has_value()) {
+        QueryWindow(window_cache_);
+    }
+    return *window_cache_.position;
 }
 
-std::optional<evgetx11::XWindowDimensions> evgetx11::X11::GetWindowPosition(Window window) {
-    auto attributes = GetWindowAttributes(window);
-
-    if (!attributes.has_value()) {
-        return std::nullopt;
+void evgetx11::X11::QueryWindow(WindowCache& cache) {
+    auto* connection = XGetXCBConnection(&display_.get());
+    auto window = static_cast<xcb_window_t>(cache.window);
+    auto root = static_cast<xcb_window_t>(XDefaultRootWindow(&display_.get()));
+
+    // Every request is sent before any reply is read, so all stale values are fetched in a single round trip.
+    std::optional<xcb_get_property_cookie_t> net_wm_name;
+    std::optional<xcb_get_property_cookie_t> wm_name;
+    if (!cache.name.has_value()) {
+        net_wm_name = xcb_get_property(
+            connection,
+            0,
+            window,
+            static_cast<xcb_atom_t>(net_wm_name_),
+            XCB_GET_PROPERTY_TYPE_ANY,
+            0,
+            std::numeric_limits<std::uint32_t>::max()
+        );
+        wm_name = xcb_get_property(
+            connection,
+            0,
+            window,
+            static_cast<xcb_atom_t>(wm_name_),
+            XCB_GET_PROPERTY_TYPE_ANY,
+            0,
+            std::numeric_limits<std::uint32_t>::max()
+        );
     }
 
-    Window parent = 0;
-    Window root = 0;
-    unsigned int n_children = 0;
-    Window* children_return = nullptr;
-
-    XQueryTree(&display_.get(), window, &root, &parent, &children_return, &n_children);
-    auto children = std::unique_ptr<Window[], decltype(&XFree)>{children_return, XFree};
-
-    // It shouldn't be necessary to check if the parent is the root, but it shouldn't hurt.
-    // See https://github.com/jordansissel/xdotool/pull/9 for more information.
-    int x_pos = 0;
-    int y_pos = 0;
-    if (parent == attributes->root) {
-        x_pos = attributes->x;
-        y_pos = attributes->y;
-    } else {
-        Window _unused = 0;
-        XTranslateCoordinates(&display_.get(), window, attributes->root, 0, 0, &x_pos, &y_pos, &_unused);
+    std::optional<xcb_get_geometry_cookie_t> geometry;
+    std::optional<xcb_query_tree_cookie_t> tree;
+    std::optional<xcb_translate_coordinates_cookie_t> translate;
+    if (!cache.size.has_value() || !cache.position.has_value()) {
+        geometry = xcb_get_geometry(connection, window);
+    }
+    if (!cache.position.has_value()) {
+        tree = xcb_query_tree(connection, window);
+        translate = xcb_translate_coordinates(connection, window, root, 0, 0);
     }
 
-    const unsigned int width = x_pos;
-    const unsigned int height = y_pos;
-
-    return {{.width = width, .height = height}};
+    SetWindowCache(
+        cache,
+        {
+            .net_wm_name = TakeReply<xcb_get_property_reply>(connection, net_wm_name),
+            .wm_name = TakeReply<xcb_get_property_reply>(connection, wm_name),
+            .geometry = TakeReply<xcb_get_geometry_reply>(connection, geometry),
+            .tree = TakeReply<xcb_query_tree_reply>(connection, tree),
+            .translate = TakeReply<xcb_translate_coordinates_reply>(connection, translate),
+        },
+        root,
+        [connection, window](xcb_window_t screen_root) {
+            return TakeReply<xcb_translate_coordinates_reply>(
+                connection,
+                std::optional{xcb_translate_coordinates(connection, window, screen_root, 0, 0)}
+            );
+        }
+    );
 }
 
 void evgetx11::X11::SetMask(unsigned char* mask, std::initializer_list<int> events) {
@@ -52,6 +52,9 @@ public:
     MOCK_METHOD(std::optional<XWindowDimensions>, GetWindowPosition, (Window window), (override));
 
     MOCK_METHOD(XEvent, NextEvent, (), (override));
+    MOCK_METHOD(void, ApplyEvent, (const XEvent& event), (override));
+    MOCK_METHOD(int, Pending, (), (override));
+    MOCK_METHOD(int, ConnectionFd, (), (override));
     MOCK_METHOD(XEventPointer, EventData, (XEvent & event), (override));
     MOCK_METHOD(Status, QueryVersion, (int& major, int& minor), (override));
     MOCK_METHOD(void, SelectEvents, (XIEventMask & mask), (override));
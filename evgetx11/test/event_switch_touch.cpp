@@ -8,14 +8,18 @@
 
 #include <array>
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <optional>
+#include <string>
+#include <variant>
 
 #include "common/x11_mock.h"
+#include "evget/event/button_action.h"
 #include "evget/event/data.h"
 #include "evget/event/device_type.h"
 #include "evget/event/entry.h"
-#include "evget/event/schema.h"
+#include "evget/event/interned_string.h"
 #include "evgetx11/event_switch.h"
 // clang-format off
 #include "evgetx11/event_switch_touch.h"
@@ -73,26 +77,26 @@ TEST(XEventSwitchTouchTest, TestTouchBegin) { // NOLINT(readability-function-cog
     auto entries = data.Entries();
 
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseMove);
-    ASSERT_EQ(entries.at(0).Data().at(0), "1");
-    ASSERT_EQ(entries.at(0).Data().at(2), evget::FromDouble(1.0));
-    ASSERT_EQ(entries.at(0).Data().at(3), evget::FromDouble(1.0));
-    ASSERT_EQ(entries.at(0).Data().at(4), "name");
-    ASSERT_FALSE(entries.at(0).Data().at(11).empty());
-    ASSERT_EQ(entries.at(0).Data().at(12), "XI_RawTouchBegin");
-    ASSERT_EQ(entries.at(0).Data().at(13), "x11");
-    ASSERT_EQ(entries.at(0).Data().at(14), "0");
+    ASSERT_EQ(std::get<evget::IntervalType>(entries.at(0).Data().at(0)), evget::IntervalType{1});
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(2)), 1.0);
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(3)), 1.0);
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(4)), "name");
+    ASSERT_FALSE(std::get<evget::InternedString>(entries.at(0).Data().at(11)).View().empty());
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(12)), "XI_RawTouchBegin");
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(13)), "x11");
+    ASSERT_EQ(std::get<evget::DeviceType>(entries.at(0).Data().at(14)), evget::DeviceType::kMouse);
 
     ASSERT_EQ(entries.at(1).Type(), evget::EntryType::kMouseClick);
-    ASSERT_EQ(entries.at(1).Data().at(0), "1");
-    ASSERT_EQ(entries.at(1).Data().at(2), evget::FromDouble(1.0));
-    ASSERT_EQ(entries.at(1).Data().at(3), evget::FromDouble(1.0));
-    ASSERT_EQ(entries.at(1).Data().at(4), "name");
-    ASSERT_FALSE(entries.at(1).Data().at(11).empty());
-    ASSERT_EQ(entries.at(1).Data().at(12), "XI_RawTouchBegin");
-    ASSERT_EQ(entries.at(1).Data().at(13), "x11");
-    ASSERT_EQ(entries.at(1).Data().at(14), "0");
-    ASSERT_EQ(entries.at(1).Data().at(15), "0");
-    ASSERT_EQ(entries.at(1).Data().at(18), "0");
+    ASSERT_EQ(std::get<evget::IntervalType>(entries.at(1).Data().at(0)), evget::IntervalType{1});
+    ASSERT_EQ(std::get<double>(entries.at(1).Data().at(2)), 1.0);
+    ASSERT_EQ(std::get<double>(entries.at(1).Data().at(3)), 1.0);
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(1).Data().at(4)), "name");
+    ASSERT_FALSE(std::get<evget::InternedString>(entries.at(1).Data().at(11)).View().empty());
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(1).Data().at(12)), "XI_RawTouchBegin");
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(1).Data().at(13)), "x11");
+    ASSERT_EQ(std::get<evget::DeviceType>(entries.at(1).Data().at(14)), evget::DeviceType::kMouse);
+    ASSERT_EQ(std::get<std::int64_t>(entries.at(1).Data().at(15)), 0);
+    ASSERT_EQ(std::get<evget::ButtonAction>(entries.at(1).Data().at(18)), evget::ButtonAction::kPress);
 }
 
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
@@ -138,14 +142,14 @@ TEST(XEventSwitchTouchTest, TestTouchUpdate) {
     auto entries = data.Entries();
 
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseMove);
-    ASSERT_EQ(entries.at(0).Data().at(0), "1");
-    ASSERT_EQ(entries.at(0).Data().at(2), evget::FromDouble(1.0));
-    ASSERT_EQ(entries.at(0).Data().at(3), evget::FromDouble(1.0));
-    ASSERT_EQ(entries.at(0).Data().at(4), "name");
-    ASSERT_FALSE(entries.at(0).Data().at(11).empty());
-    ASSERT_EQ(entries.at(0).Data().at(12), "XI_RawTouchUpdate");
-    ASSERT_EQ(entries.at(0).Data().at(13), "x11");
-    ASSERT_EQ(entries.at(0).Data().at(14), "0");
+    ASSERT_EQ(std::get<evget::IntervalType>(entries.at(0).Data().at(0)), evget::IntervalType{1});
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(2)), 1.0);
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(3)), 1.0);
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(4)), "name");
+    ASSERT_FALSE(std::get<evget::InternedString>(entries.at(0).Data().at(11)).View().empty());
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(12)), "XI_RawTouchUpdate");
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(13)), "x11");
+    ASSERT_EQ(std::get<evget::DeviceType>(entries.at(0).Data().at(14)), evget::DeviceType::kMouse);
 }
 
 TEST(XEventSwitchTouchTest, TestTouchEnd) { // NOLINT(readability-function-cognitive-complexity)
@@ -197,26 +201,26 @@ TEST(XEventSwitchTouchTest, TestTouchEnd) { // NOLINT(readability-function-cogni
     auto entries = data.Entries();
 
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseMove);
-    ASSERT_EQ(entries.at(0).Data().at(0), "1");
-    ASSERT_EQ(entries.at(0).Data().at(2), evget::FromDouble(1.0));
-    ASSERT_EQ(entries.at(0).Data().at(3), evget::FromDouble(1.0));
-    ASSERT_EQ(entries.at(0).Data().at(4), "name");
-    ASSERT_FALSE(entries.at(0).Data().at(11).empty());
-    ASSERT_EQ(entries.at(0).Data().at(12), "XI_RawTouchEnd");
-    ASSERT_EQ(entries.at(0).Data().at(13), "x11");
-    ASSERT_EQ(entries.at(0).Data().at(14), "0");
+    ASSERT_EQ(std::get<evget::IntervalType>(entries.at(0).Data().at(0)), evget::IntervalType{1});
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(2)), 1.0);
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(3)), 1.0);
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(4)), "name");
+    ASSERT_FALSE(std::get<evget::InternedString>(entries.at(0).Data().at(11)).View().empty());
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(12)), "XI_RawTouchEnd");
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(13)), "x11");
+    ASSERT_EQ(std::get<evget::DeviceType>(entries.at(0).Data().at(14)), evget::DeviceType::kMouse);
 
     ASSERT_EQ(entries.at(1).Type(), evget::EntryType::kMouseClick);
-    ASSERT_EQ(entries.at(1).Data().at(0), "1");
-    ASSERT_EQ(entries.at(1).Data().at(2), evget::FromDouble(1.0));
-    ASSERT_EQ(entries.at(1).Data().at(3), evget::FromDouble(1.0));
-    ASSERT_EQ(entries.at(1).Data().at(4), "name");
-    ASSERT_FALSE(entries.at(1).Data().at(11).empty());
-    ASSERT_EQ(entries.at(1).Data().at(12), "XI_RawTouchEnd");
-    ASSERT_EQ(entries.at(1).Data().at(13), "x11");
-    ASSERT_EQ(entries.at(1).Data().at(14), "0");
-    ASSERT_EQ(entries.at(1).Data().at(15), "0");
-    ASSERT_EQ(entries.at(1).Data().at(18), "1");
+    ASSERT_EQ(std::get<evget::IntervalType>(entries.at(1).Data().at(0)), evget::IntervalType{1});
+    ASSERT_EQ(std::get<double>(entries.at(1).Data().at(2)), 1.0);
+    ASSERT_EQ(std::get<double>(entries.at(1).Data().at(3)), 1.0);
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(1).Data().at(4)), "name");
+    ASSERT_FALSE(std::get<evget::InternedString>(entries.at(1).Data().at(11)).View().empty());
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(1).Data().at(12)), "XI_RawTouchEnd");
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(1).Data().at(13)), "x11");
+    ASSERT_EQ(std::get<evget::DeviceType>(entries.at(1).Data().at(14)), evget::DeviceType::kMouse);
+    ASSERT_EQ(std::get<std::int64_t>(entries.at(1).Data().at(15)), 0);
+    ASSERT_EQ(std::get<evget::ButtonAction>(entries.at(1).Data().at(18)), evget::ButtonAction::kRelease);
 }
 
 // NOLINTEND(modernize-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays)
@@ -3,13 +3,17 @@
 #include <X11/X.h>
 #include <X11/extensions/XI2.h>
 #include <X11/extensions/XInput2.h>
+#include <evget/event/button_action.h>
 #include <evget/event/device_type.h>
 #include <evget/event/entry.h>
-#include <evget/event/schema.h>
+#include <evget/event/interned_string.h>
 #include <evgetx11/input_event.h>
 
 #include <array>
+#include <cstdint>
+#include <string>
 #include <utility>
+#include <variant>
 
 #include "common/x11_mock.h"
 #include "evgetx11/event_switch.h"
@@ -51,18 +55,18 @@ TEST(EventTransformer, TransformEvent) {
     const auto& entries = data.Entries();
 
     ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseClick);
-    ASSERT_EQ(entries.at(0).Data().at(0), "");
-    ASSERT_EQ(entries.at(0).Data().at(2), evget::FromDouble(1.0));
-    ASSERT_EQ(entries.at(0).Data().at(3), evget::FromDouble(1.0));
-    ASSERT_EQ(entries.at(0).Data().at(4), "name");
-    ASSERT_FALSE(entries.at(0).Data().at(11).empty());
-    ASSERT_EQ(entries.at(0).Data().at(12), "XI_RawButtonPress");
-    ASSERT_EQ(entries.at(0).Data().at(13), "x11");
-    ASSERT_EQ(entries.at(0).Data().at(14), "0");
-    ASSERT_EQ(entries.at(0).Data().at(15), "");
-    ASSERT_EQ(entries.at(0).Data().at(16), "0");
-    ASSERT_EQ(entries.at(0).Data().at(17), "");
-    ASSERT_EQ(entries.at(0).Data().at(18), "0");
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(entries.at(0).Data().at(0)));
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(2)), 1.0);
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(3)), 1.0);
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(4)), "name");
+    ASSERT_FALSE(std::get<evget::InternedString>(entries.at(0).Data().at(11)).View().empty());
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(12)), "XI_RawButtonPress");
+    ASSERT_EQ(std::get<evget::InternedString>(entries.at(0).Data().at(13)), "x11");
+    ASSERT_EQ(std::get<evget::DeviceType>(entries.at(0).Data().at(14)), evget::DeviceType::kMouse);
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(entries.at(0).Data().at(15)));
+    ASSERT_EQ(std::get<std::int64_t>(entries.at(0).Data().at(16)), 0);
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(entries.at(0).Data().at(17)));
+    ASSERT_EQ(std::get<evget::ButtonAction>(entries.at(0).Data().at(18)), evget::ButtonAction::kPress);
 }
 
 // NOLINTEND(modernize-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays)
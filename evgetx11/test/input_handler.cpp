@@ -0,0 +1,251 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <X11/X.h>
+#include <X11/Xlib.h>
+#include <X11/extensions/XI2.h>
+#include <X11/extensions/XInput2.h>
+#include <boost/asio/awaitable.hpp>
+#include <unistd.h>
+#include <xorg/xserver-properties.h>
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "common/x11_mock.h"
+#include "evget/async/scheduler/scheduler.h"
+#include "evget/error.h"
+#include "evget/event/entry.h"
+#include "evgetx11/event_switch.h"
+#include "evgetx11/event_switch_pointer_key.h"
+// clang-format off
+#include "evgetx11/event_transformer.h"
+// clang-format on
+#include "evgetx11/input_event.h"
+#include "evgetx11/input_handler.h"
+#include "evgetx11/x11.h"
+
+namespace {
+
+using testing::_;
+using testing::ByMove;
+using testing::InSequence;
+using testing::Return;
+
+class Pipe {
+public:
+    Pipe() {
+        EXPECT_EQ(pipe(fds_.data()), 0);
+    }
+
+    Pipe(const Pipe&) = delete;
+    Pipe(Pipe&&) = delete;
+    Pipe& operator=(const Pipe&) = delete;
+    Pipe& operator=(Pipe&&) = delete;
+
+    ~Pipe() {
+        close(fds_[0]);
+        close(fds_[1]);
+    }
+
+    [[nodiscard]] int ReadEnd() const {
+        return fds_[0];
+    }
+
+    void Write() const {
+        const char byte{};
+        EXPECT_EQ(write(fds_[1], &byte, 1), 1);
+    }
+
+    void Read() const {
+        char byte{};
+        EXPECT_EQ(read(fds_[0], &byte, 1), 1);
+    }
+
+private:
+    std::array<int, 2> fds_{};
+};
+
+struct BatchResult {
+    std::optional<evget::Result<void>> result;
+    std::vector<evgetx11::InputEvent> events;
+};
+
+void ExpectEvents(test::X11ApiMock& x_wrapper_mock, int times) {
+    EXPECT_CALL(x_wrapper_mock, NextEvent).Times(times).WillRepeatedly(Return(XEvent{}));
+    EXPECT_CALL(x_wrapper_mock, EventData).Times(times).WillRepeatedly([](XEvent&) {
+        return evgetx11::XEventPointer{nullptr, [](XGenericEventCookie*) {}};
+    });
+}
+
+std::shared_ptr<BatchResult> RunNextBatch(evgetx11::InputHandler& input_handler) {
+    auto scheduler = std::make_shared<evget::Scheduler>();
+    auto result = std::make_shared<BatchResult>();
+
+    scheduler->Spawn(
+        [](evgetx11::InputHandler& input_handler,
+           std::shared_ptr<BatchResult> result) -> boost::asio::awaitable<void> {
+            result->result = co_await input_handler.NextBatch(result->events);
+        }(input_handler, result)
+    );
+    scheduler->Join();
+
+    return result;
+}
+
+evgetx11::QueryPointerResult CreatePointerResult(double root_x, double root_y) {
+    auto result = test::CreatePointerResult();
+    result.root_x = root_x;
+    result.root_y = root_y;
+    return result;
+}
+
+} // namespace
+
+TEST(InputHandlerTest, PendingEventReturnedWithoutWaiting) {
+    test::X11ApiMock x_wrapper_mock{};
+    {
+        const InSequence sequence{};
+        EXPECT_CALL(x_wrapper_mock, Pending).WillOnce(Return(1));
+        EXPECT_CALL(x_wrapper_mock, Pending).WillOnce(Return(0));
+    }
+    EXPECT_CALL(x_wrapper_mock, ConnectionFd).Times(0);
+    ExpectEvents(x_wrapper_mock, 1);
+
+    auto result = [&x_wrapper_mock] {
+        evgetx11::InputHandler input_handler{x_wrapper_mock};
+        return RunNextBatch(input_handler);
+    }();
+
+    ASSERT_TRUE(result->result.has_value());
+    ASSERT_TRUE(result->result->has_value());
+    ASSERT_EQ(result->events.size(), 1);
+}
+
+TEST(InputHandlerTest, WaitsForReadableConnection) {
+    const Pipe pipe{};
+    test::X11ApiMock x_wrapper_mock{};
+    {
+        const InSequence sequence{};
+        EXPECT_CALL(x_wrapper_mock, Pending).WillOnce(Return(0));
+        EXPECT_CALL(x_wrapper_mock, ConnectionFd).WillOnce(Return(pipe.ReadEnd()));
+        EXPECT_CALL(x_wrapper_mock, Pending).WillOnce([&pipe] {
+            pipe.Read();
+            return 1;
+        });
+        EXPECT_CALL(x_wrapper_mock, Pending).WillOnce(Return(0));
+    }
+    ExpectEvents(x_wrapper_mock, 1);
+    pipe.Write();
+
+    auto result = [&x_wrapper_mock] {
+        evgetx11::InputHandler input_handler{x_wrapper_mock};
+        return RunNextBatch(input_handler);
+    }();
+
+    ASSERT_TRUE(result->result.has_value());
+    ASSERT_TRUE(result->result->has_value());
+    ASSERT_EQ(result->events.size(), 1);
+}
+
+TEST(InputHandlerTest, NextBatchDrainsPendingEvents) {
+    test::X11ApiMock x_wrapper_mock{};
+    {
+        const InSequence sequence{};
+        EXPECT_CALL(x_wrapper_mock, Pending).WillOnce(Return(3));
+        EXPECT_CALL(x_wrapper_mock, Pending).WillOnce(Return(2));
+    }
+    EXPECT_CALL(x_wrapper_mock, ConnectionFd).Times(0);
+    ExpectEvents(x_wrapper_mock, 3);
+
+    auto result = [&x_wrapper_mock] {
+        evgetx11::InputHandler input_handler{x_wrapper_mock};
+        return RunNextBatch(input_handler);
+    }();
+
+    ASSERT_TRUE(result->result.has_value());
+    ASSERT_TRUE(result->result->has_value());
+    ASSERT_EQ(result->events.size(), 3);
+}
+
+// NOLINTBEGIN(modernize-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays)
+TEST(InputHandlerTest, NextBatchMotionsQueryPointerWhenTransformed) {
+    test::X11ApiMock x_wrapper_mock{};
+    test::SetXWrapperMocks(x_wrapper_mock);
+    evgetx11::EventSwitch x_event_switch{x_wrapper_mock};
+    evgetx11::EventSwitchPointerKey x_event_switch_pointer_key{x_wrapper_mock};
+
+    auto valuator_class_info = test::CreateXiValuatorClassInfo();
+    valuator_class_info.number = 0;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    std::array<XIAnyClassInfo*, 3> any_class_info = {reinterpret_cast<XIAnyClassInfo*>(&valuator_class_info)};
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+    std::string name = "name";
+    auto xi_device_info = test::CreateXiDeviceInfo(any_class_info, name);
+
+    std::array<unsigned char, 1> valuator_mask = {1};
+    std::array<double, 1> values = {1};
+    auto device_event = test::CreateXiRawEvent(XI_RawMotion, valuator_mask, values);
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+    EXPECT_CALL(x_wrapper_mock, AtomName)
+        .WillOnce(
+            Return(
+                ByMove<std::unique_ptr<char[], decltype(&XFree)>>(
+                    {const_cast<char*>(AXIS_LABEL_PROP_ABS_X), [](void*) { return 0; }}
+                )
+            )
+        );
+    // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+    x_event_switch_pointer_key.RefreshDevices(1, 1, evget::DeviceType::kMouse, "name", xi_device_info, x_event_switch);
+
+    {
+        const InSequence sequence{};
+        EXPECT_CALL(x_wrapper_mock, Pending).WillOnce(Return(2));
+        EXPECT_CALL(x_wrapper_mock, Pending).WillOnce(Return(1));
+    }
+    EXPECT_CALL(x_wrapper_mock, NextEvent).Times(2).WillRepeatedly([&device_event] {
+        return test::CreateXEvent(device_event);
+    });
+    EXPECT_CALL(x_wrapper_mock, EventData).Times(2).WillRepeatedly([](XEvent& event) {
+        return evgetx11::XEventPointer{&event.xcookie, [](XGenericEventCookie*) {}};
+    });
+    EXPECT_CALL(x_wrapper_mock, GetActiveWindow).WillRepeatedly(Return(std::nullopt));
+    EXPECT_CALL(x_wrapper_mock, GetFocusWindow).WillRepeatedly(Return(std::nullopt));
+
+    auto result = [&x_wrapper_mock] {
+        evgetx11::InputHandler input_handler{x_wrapper_mock};
+        return RunNextBatch(input_handler);
+    }();
+
+    ASSERT_TRUE(result->result.has_value());
+    ASSERT_TRUE(result->result->has_value());
+    ASSERT_EQ(result->events.size(), 2);
+
+    // Both motions are read before either is transformed, so each one must be applied before its pointer query.
+    {
+        const InSequence sequence{};
+        EXPECT_CALL(x_wrapper_mock, ApplyEvent(_));
+        EXPECT_CALL(x_wrapper_mock, QueryPointer).WillOnce([] { return CreatePointerResult(1, 2); });
+        EXPECT_CALL(x_wrapper_mock, ApplyEvent(_));
+        EXPECT_CALL(x_wrapper_mock, QueryPointer).WillOnce([] { return CreatePointerResult(3, 4); });
+    }
+
+    auto transformer = evgetx11::EventTransformer{x_wrapper_mock, x_event_switch, x_event_switch_pointer_key};
+    auto data = transformer.TransformEvents(std::span{result->events});
+    const auto& entries = data.Entries();
+
+    ASSERT_EQ(entries.size(), 2);
+    ASSERT_EQ(entries.at(0).Type(), evget::EntryType::kMouseMove);
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(2)), 1.0);
+    ASSERT_EQ(std::get<double>(entries.at(0).Data().at(3)), 2.0);
+    ASSERT_EQ(entries.at(1).Type(), evget::EntryType::kMouseMove);
+    ASSERT_EQ(std::get<double>(entries.at(1).Data().at(2)), 3.0);
+    ASSERT_EQ(std::get<double>(entries.at(1).Data().at(3)), 4.0);
+}
+// NOLINTEND(modernize-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays)
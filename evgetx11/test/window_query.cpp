@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+
+#include <xcb/xcb.h>
+#include <xcb/xproto.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "evgetx11/window_query.h"
+
+namespace {
+
+constexpr xcb_window_t kRoot = 1;
+constexpr xcb_window_t kOtherRoot = 2;
+
+// Replies are allocated the same way as XCB, with any variable length data following the reply.
+template <typename T>
+evgetx11::XcbReply<T> CreateReply(T value, std::string_view data = {}) {
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc, hicpp-no-malloc)
+    auto* reply = static_cast<T*>(std::malloc(sizeof(T) + data.size()));
+    std::memcpy(reply, &value, sizeof(T));
+    if (!data.empty()) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memcpy(reply + 1, data.data(), data.size());
+    }
+    return {reply, std::free};
+}
+
+evgetx11::XcbReply<xcb_get_property_reply_t> CreatePropertyReply(std::string_view value) {
+    return CreateReply(
+        xcb_get_property_reply_t{.format = 8, .value_len = static_cast<std::uint32_t>(value.size())},
+        value
+    );
+}
+
+evgetx11::XcbReply<xcb_get_geometry_reply_t> CreateGeometryReply(xcb_window_t root) {
+    return CreateReply(xcb_get_geometry_reply_t{.root = root, .x = 1, .y = 2, .width = 3, .height = 4});
+}
+
+evgetx11::XcbReply<xcb_translate_coordinates_reply_t> CreateTranslateReply(std::int16_t x_pos, std::int16_t y_pos) {
+    return CreateReply(xcb_translate_coordinates_reply_t{.dst_x = x_pos, .dst_y = y_pos});
+}
+
+xcb_get_geometry_reply_t*
+SuccessfulReply(xcb_connection_t* /*connection*/, xcb_get_geometry_cookie_t /*cookie*/, xcb_generic_error_t** error) {
+    *error = nullptr;
+    return CreateGeometryReply(kRoot).release();
+}
+
+xcb_get_geometry_reply_t*
+FailedReply(xcb_connection_t* /*connection*/, xcb_get_geometry_cookie_t /*cookie*/, xcb_generic_error_t** error) {
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc, hicpp-no-malloc)
+    *error = static_cast<xcb_generic_error_t*>(std::calloc(1, sizeof(xcb_generic_error_t)));
+    return nullptr;
+}
+
+xcb_get_geometry_reply_t*
+UnexpectedReply(xcb_connection_t* /*connection*/, xcb_get_geometry_cookie_t /*cookie*/, xcb_generic_error_t** error) {
+    ADD_FAILURE() << "reply taken for a request that was not sent";
+    *error = nullptr;
+    return nullptr;
+}
+
+auto NoTranslate() {
+    return [](xcb_window_t) {
+        ADD_FAILURE() << "unexpected translate request";
+        return evgetx11::XcbReply<xcb_translate_coordinates_reply_t>{nullptr, std::free};
+    };
+}
+
+} // namespace
+
+TEST(WindowQueryTest, TakeReplySuccess) {
+    auto reply = evgetx11::TakeReply<SuccessfulReply>(nullptr, std::optional{xcb_get_geometry_cookie_t{}});
+
+    ASSERT_NE(reply, nullptr);
+    ASSERT_EQ(reply->width, 3);
+}
+
+TEST(WindowQueryTest, TakeReplyError) {
+    auto reply = evgetx11::TakeReply<FailedReply>(nullptr, std::optional{xcb_get_geometry_cookie_t{}});
+
+    ASSERT_EQ(reply, nullptr);
+}
+
+TEST(WindowQueryTest, TakeReplyNotSent) {
+    auto reply = evgetx11::TakeReply<UnexpectedReply>(nullptr, std::optional<xcb_get_geometry_cookie_t>{});
+
+    ASSERT_EQ(reply, nullptr);
+}
+
+TEST(WindowQueryTest, NamePrefersNetWmName) {
+    evgetx11::WindowCache cache{};
+    evgetx11::SetWindowCache(
+        cache,
+        {.net_wm_name = CreatePropertyReply("net_wm_name"), .wm_name = CreatePropertyReply("wm_name")},
+        kRoot,
+        NoTranslate()
+    );
+
+    ASSERT_TRUE(cache.name.has_value());
+    ASSERT_EQ(*cache.name, "net_wm_name");
+}
+
+TEST(WindowQueryTest, NameFallsBackToWmName) {
+    evgetx11::WindowCache cache{};
+    evgetx11::SetWindowCache(
+        cache,
+        {.net_wm_name = CreatePropertyReply(""), .wm_name = CreatePropertyReply("wm_name")},
+        kRoot,
+        NoTranslate()
+    );
+
+    ASSERT_TRUE(cache.name.has_value());
+    ASSERT_EQ(*cache.name, "wm_name");
+}
+
+TEST(WindowQueryTest, NameFailed) {
+    evgetx11::WindowCache cache{};
+    evgetx11::SetWindowCache(cache, {.net_wm_name = CreatePropertyReply("")}, kRoot, NoTranslate());
+
+    ASSERT_TRUE(cache.name.has_value());
+    ASSERT_FALSE(cache.name->has_value());
+}
+
+TEST(WindowQueryTest, FreshValuesKept) {
+    evgetx11::WindowCache cache{
+        .name = std::optional<std::string>{"name"},
+        .position = std::optional{evgetx11::XWindowDimensions{.width = 5, .height = 6}},
+        .size = std::optional{evgetx11::XWindowDimensions{.width = 7, .height = 8}},
+    };
+    evgetx11::SetWindowCache(cache, {}, kRoot, NoTranslate());
+
+    ASSERT_EQ(*cache.name, "name");
+    ASSERT_EQ(cache.position->value().width, 5);
+    ASSERT_EQ(cache.size->value().width, 7);
+}
+
+TEST(WindowQueryTest, GeometryFailed) {
+    evgetx11::WindowCache cache{};
+    evgetx11::SetWindowCache(cache, {.translate = CreateTranslateReply(1, 1)}, kRoot, NoTranslate());
+
+    ASSERT_TRUE(cache.size.has_value());
+    ASSERT_FALSE(cache.size->has_value());
+    ASSERT_TRUE(cache.position.has_value());
+    ASSERT_FALSE(cache.position->has_value());
+}
+
+TEST(WindowQueryTest, PositionParentIsRoot) {
+    evgetx11::WindowCache cache{};
+    evgetx11::SetWindowCache(
+        cache,
+        {.geometry = CreateGeometryReply(kRoot),
+         .tree = CreateReply(xcb_query_tree_reply_t{.root = kRoot, .parent = kRoot}),
+         .translate = CreateTranslateReply(9, 9)},
+        kRoot,
+        NoTranslate()
+    );
+
+    ASSERT_EQ(cache.size->value().width, 3);
+    ASSERT_EQ(cache.size->value().height, 4);
+    ASSERT_EQ(cache.position->value().width, 1);
+    ASSERT_EQ(cache.position->value().height, 2);
+}
+
+TEST(WindowQueryTest, PositionTranslated) {
+    evgetx11::WindowCache cache{};
+    evgetx11::SetWindowCache(
+        cache,
+        {.geometry = CreateGeometryReply(kRoot),
+         .tree = CreateReply(xcb_query_tree_reply_t{.root = kRoot, .parent = 3}),
+         .translate = CreateTranslateReply(9, 10)},
+        kRoot,
+        NoTranslate()
+    );
+
+    ASSERT_EQ(cache.position->value().width, 9);
+    ASSERT_EQ(cache.position->value().height, 10);
+}
+
+TEST(WindowQueryTest, PositionTranslatedOnAnotherScreen) {
+    evgetx11::WindowCache cache{};
+    int n_translates = 0;
+    evgetx11::SetWindowCache(
+        cache,
+        {.geometry = CreateGeometryReply(kOtherRoot),
+         .tree = CreateReply(xcb_query_tree_reply_t{.root = kOtherRoot, .parent = 3}),
+         .translate = CreateTranslateReply(9, 10)},
+        kRoot,
+        [&n_translates](xcb_window_t root) {
+            EXPECT_EQ(root, kOtherRoot);
+            n_translates++;
+            return CreateTranslateReply(11, 12);
+        }
+    );
+
+    ASSERT_EQ(n_translates, 1);
+    ASSERT_EQ(cache.position->value().width, 11);
+    ASSERT_EQ(cache.position->value().height, 12);
+}
+
+TEST(WindowQueryTest, PositionTranslateFailed) {
+    evgetx11::WindowCache cache{};
+    evgetx11::SetWindowCache(
+        cache,
+        {.geometry = CreateGeometryReply(kRoot), .tree = CreateReply(xcb_query_tree_reply_t{.root = kRoot, .parent = 3})},
+        kRoot,
+        NoTranslate()
+    );
+
+    ASSERT_EQ(cache.position->value().width, 0);
+    ASSERT_EQ(cache.position->value().height, 0);
+}